@@ -240,7 +240,8 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
             METRIC_KEY(FULL_DEVICE_NAME),
             METRIC_KEY(OPTIMIZATION_CAPABILITIES),
-            METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS) };
+            METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+            METRIC_KEY(IMPORT_EXPORT_SUPPORT) };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, supportedMetrics);
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {
@@ -269,6 +270,8 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
         // TODO: fill with actual values
         using uint = unsigned int;
         IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(uint{1}, uint{1}, uint{1}));
+    } else if (METRIC_KEY(IMPORT_EXPORT_SUPPORT) == name) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else  {
         THROW_IE_EXCEPTION << "Unsupported device metric: " << name;
     }
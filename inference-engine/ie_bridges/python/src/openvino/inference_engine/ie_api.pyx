@@ -938,7 +938,13 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef C.IEExecNetwork* impl = self.impl.get()
+        cdef int c_num_requests = num_requests
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -1059,6 +1065,49 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+
+    ## Sets caller-owned numpy arrays as input and output blobs of the infer request without copying
+    #
+    #  \note The arrays must be C-contiguous and have the element type and the number of elements of the
+    #  corresponding blobs. The request reads inputs from and writes outputs to the memory of the arrays,
+    #  so they must not be changed while the inference is running. The request keeps references to the arrays
+    #  until other blobs are set for the same inputs and outputs.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects
+    #  @param outputs: A dictionary that maps output layer names to `numpy.ndarray` objects
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  image = np.empty((1, 3, 224, 224), dtype=np.float32)
+    #  prob = np.empty((1, 1000), dtype=np.float32)
+    #  exec_net.requests[0].set_arrays(inputs={input_blob: image}, outputs={'prob': prob})
+    #  image[:] = next_image
+    #  exec_net.requests[0].infer()
+    #  np.argmax(prob)
+    #  ```
+    def set_arrays(self, inputs=None, outputs=None):
+        cdef Blob blob
+        for names, arrays in ((self._inputs_list, inputs), (self._outputs_list, outputs)):
+            if arrays is None:
+                continue
+            for name, array in arrays.items():
+                if name not in names:
+                    raise ValueError(f"No blob with name {name} found in network")
+                if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+                    raise ValueError(f"Array for blob {name} must be a C-contiguous numpy.ndarray")
+                blob = Blob()
+                deref(self.impl).getBlobPtr(name.encode(), blob._ptr)
+                tensor_desc = blob.tensor_desc
+                if array.dtype != format_map.get(tensor_desc.precision):
+                    raise ValueError(f"Data type {array.dtype} of array for blob {name} "
+                                     f"doesn't match to blob precision {tensor_desc.precision}")
+                if array.size != np.prod(tensor_desc.dims):
+                    raise ValueError(f"Number of elements in array for blob {name} {array.size} and "
+                                     f"required by blob {np.prod(tensor_desc.dims)} are not equal")
+                self.set_blob(name, Blob(tensor_desc, array))
+
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
@@ -1079,7 +1128,9 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        cdef C.InferRequestWrap* impl = self.impl
+        with nogil:
+            deref(impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1098,7 +1149,9 @@ cdef class InferRequest:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        cdef C.InferRequestWrap* impl = self.impl
+        with nogil:
+            deref(impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1132,7 +1185,12 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef C.InferRequestWrap* impl = self.impl
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1221,12 +1279,23 @@ cdef class InferRequest:
         deref(self.impl).setBatch(size)
 
     def _fill_inputs(self, inputs):
+        cdef Blob blob
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
-            if self.input_blobs[k].tensor_desc.precision == "FP16":
-                self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
+            # get the only blob instead of building all input_blobs
+            if k in self._user_blobs:
+                blob = self._user_blobs[k]
+            else:
+                blob = Blob()
+                deref(self.impl).getBlobPtr(k.encode(), blob._ptr)
+            if blob._array_data is not None and isinstance(v, np.ndarray) and \
+                    v.ctypes.data == blob._array_data.ctypes.data and v.nbytes == blob._array_data.nbytes:
+                # the array is already set as the input blob with set_arrays()
+                continue
+            if blob.tensor_desc.precision == "FP16":
+                blob.buffer[:] = v.view(dtype=np.int16)
             else:
-                self.input_blobs[k].buffer[:] = v
+                blob.buffer[:] = v
 
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
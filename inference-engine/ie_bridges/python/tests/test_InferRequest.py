@@ -512,3 +512,59 @@ def test_resize_algorithm_work(device):
     res_2 = np.sort(request.output_blobs['fc_out'].buffer)
 
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
+
+
+def test_set_arrays(device):
+    exec_net = load_sample_model(device)
+    request = exec_net.requests[0]
+    img = np.empty((1, 3, 32, 32), dtype=np.float32)
+    out = np.zeros(request.output_blobs['fc_out'].buffer.shape, dtype=np.float32)
+    request.set_arrays(inputs={'data': img}, outputs={'fc_out': out})
+    img[:] = read_image()
+    request.infer()
+    assert np.argmax(out) == 2
+    assert request.input_blobs['data'].buffer.ctypes.data == img.ctypes.data
+    request.infer({'data': img})
+    assert np.argmax(out) == 2
+    del exec_net
+
+
+def test_set_arrays_not_contiguous(device):
+    exec_net = load_sample_model(device)
+    img = np.asfortranarray(read_image())
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].set_arrays(inputs={'data': img})
+    assert "must be a C-contiguous numpy.ndarray" in str(e.value)
+    del exec_net
+
+
+def test_set_arrays_wrong_type(device):
+    exec_net = load_sample_model(device)
+    img = read_image().astype(np.float64)
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].set_arrays(inputs={'data': img})
+    assert "doesn't match to blob precision" in str(e.value)
+    del exec_net
+
+
+def test_infer_from_threads(device):
+    num_requests = 4
+    exec_net = load_sample_model(device, num_requests=num_requests)
+    img = read_image()
+    results = [None] * num_requests
+
+    def run(request_id):
+        request = exec_net.requests[request_id]
+        for _ in range(10):
+            request.async_infer({'data': img})
+            request.wait()
+            request.infer({'data': img})
+        results[request_id] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(num_requests)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert results == [2] * num_requests
+    del exec_net
@@ -35,5 +35,28 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs.
+ * Each subgraph gets a pool of device infer requests shared by all infer requests of the executable network,
+ * so a subgraph of one infer request runs in parallel with the next subgraph of the previous one.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINED_EXECUTION);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get statistics of subgraph stages of an executable network loaded with
+ * HETERO_CONFIG_KEY(PIPELINED_EXECUTION) set to CONFIG_VALUE(YES).
+ *
+ * Metric returns a value of std::map<std::string, float> type with "STAGE_<id>_UTILIZATION" (a fraction of time
+ * the stage runs at least one request while the pipeline is not empty), "STAGE_<id>_BUBBLES" and
+ * "STAGE_<id>_BUBBLE_TIME_MS" (number and duration of idle gaps of the stage while the pipeline is not empty),
+ * "STAGE_<id>_INFERENCES" and "STAGE_<id>_POOL_SIZE" keys per subgraph.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PIPELINE_STATISTICS, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -158,6 +160,39 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get statistics of the CPU plugin weights cache, which shares constant data of networks
+ * and streams placed on the same NUMA node.
+ *
+ * Metric returns a value of std::map<std::string, uint64_t> type with "NUMA_NODE_<id>_HITS", "NUMA_NODE_<id>_MISSES",
+ * "NUMA_NODE_<id>_BYTES" and "NUMA_NODE_<id>_BYTES_SAVED" keys per NUMA node. The cache is shared by all networks
+ * loaded to the plugin, so the values are accumulated since the plugin creation.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric which defines support of import / export functionality by plugin.
+ *
+ * Devices which report `true` are used with the network cache enabled by CONFIG_KEY(CACHE_DIR).
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get an unsigned int value of number of networks loaded from the network cache.
+ *
+ * The metric is provided by InferenceEngine::Core for every device, e.g.
+ * ie.GetMetric("CPU", METRIC_KEY(NETWORK_CACHE_HITS))
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned int value of number of networks which were compiled and stored to the network cache.
+ *
+ * The metric is provided by InferenceEngine::Core for every device, e.g.
+ * ie.GetMetric("CPU", METRIC_KEY(NETWORK_CACHE_MISSES))
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_MISSES, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -219,6 +254,94 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for setting inter-operation parallelism inside a CPU stream.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (independent branches of the graph are executed concurrently
+ * within the stream, best for latency of multi-branch topologies)
+ * PluginConfigParams::NO (default, operations are executed one by one in topological order)
+ *
+ * The schedule is level-synchronous: an operation is placed into the stage equal to the longest path
+ * to it from the graph inputs, and all operations of a stage finish before the next stage starts.
+ * So a long operation of one branch delays the operations of the other branches in the next stages,
+ * the gain is the best for branches of similar cost.
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
+/**
+ * @brief The name for setting priority of inference requests of the network in CPU streams.
+ *
+ * Networks loaded with this option and the same streams configuration share streams, pending inference requests
+ * with higher priority are started before pending requests with lower priority. Networks loaded without
+ * this option get streams of their own, so set it (e.g. CPU_PRIORITY_NORMAL) for every network
+ * which competes with latency critical ones.
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * CPU_PRIORITY_HIGH (latency critical requests)
+ * CPU_PRIORITY_NORMAL (default)
+ * CPU_PRIORITY_LOW (bulk requests)
+ */
+DECLARE_CONFIG_KEY(CPU_INFER_PRIORITY);
+DECLARE_CONFIG_VALUE(CPU_PRIORITY_HIGH);
+DECLARE_CONFIG_VALUE(CPU_PRIORITY_NORMAL);
+DECLARE_CONFIG_VALUE(CPU_PRIORITY_LOW);
+
+/**
+ * @brief The name for setting dynamic shapes mode of the CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (input blobs with dimensions which differ from the network ones can be set to
+ * infer requests, the compiled network is reinitialized for these dimensions on demand)
+ * PluginConfigParams::NO (default, input blobs must have the dimensions of the network inputs)
+ * Output blobs allocated by an infer request are reallocated if their dimensions change, so they should be
+ * requested with GetBlob() after the inference. Output blobs set with SetBlob() are reshaped, the inference
+ * throws if they have less elements than the new output dimensions require.
+ * The option cannot be used together with KEY_DYN_BATCH_ENABLED.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES);
+
+/**
+ * @brief The name for setting the number of graphs compiled for different input dimensions,
+ * which are kept per CPU stream in dynamic shapes mode. Least recently used graphs are released first.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with positive integer values, default is 8.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The name for setting the number of the last executions of every node for which the CPU plugin keeps
+ * start and finish timestamps when KEY_PERF_COUNT is YES.
+ *
+ * The timestamps are kept per CPU stream, they give percentiles of execution time of nodes in the executable graph
+ * info and are used for the trace set with KEY_CPU_PERF_COUNT_TRACE.
+ * It is passed to Core::LoadNetwork(), this option should be used with non-negative integer values,
+ * default is 0 (only average execution time is collected).
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_HISTORY);
+
+/**
+ * @brief The name for setting a path to a file, where the CPU plugin writes kept timestamps of node executions
+ * in Chrome trace event JSON format (which Perfetto also opens).
+ *
+ * Passed to ExecutableNetwork::SetConfig() it writes the trace at once. Passed to Core::LoadNetwork() it writes
+ * the trace when the executable network is released, an empty string (default) disables it.
+ * Executions of all CPU streams are written into one trace: a trace process corresponds to a stream and a trace
+ * thread to a thread which executed the nodes. Nodes fused into or merged with an executed node are shown nested
+ * into its executions.
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_TRACE);
+
+/**
+ * @brief The name for setting export support of networks loaded to the CPU plugin.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (the network transformed by the plugin is kept, so ExecutableNetwork::Export() can be called)
+ * PluginConfigParams::NO (default, export throws unless KEY_CACHE_DIR is set for the CPU plugin)
+ * The exported network skips only the common transformations on import: low precision and legacy conversions,
+ * graph fusions, primitive selection and weights reorders are done again, as for Core::LoadNetwork().
+ */
+DECLARE_CONFIG_KEY(CPU_EXPORTABLE);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -372,6 +495,15 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+*
+* When the key is set without a device name, InferenceEngine::Core also caches compiled networks for
+* devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT): the first LoadNetwork exports the network
+* to the directory and next LoadNetwork calls with the same network, device and configuration import it.
+* Networks read from IR files by Core::ReadNetwork are identified by paths, sizes and modification times
+* of the files; the content of other networks is hashed once per ngraph::Function, so a function changed
+* through the nGraph API after it was loaded must be cloned to be cached as a new network.
+* The CPU plugin repeats the plugin specific compilation on import, so its cache saves only
+* the common transformations.
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
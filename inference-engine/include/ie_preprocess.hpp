@@ -63,6 +63,9 @@ class PreProcessInfo {
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
+    // Whether mean values and scales are applied by the built-in pre-processing
+    bool _fusedNormalization = false;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index
@@ -221,5 +224,28 @@ public:
     ColorFormat getColorFormat() const {
         return _colorFormat;
     }
+
+    /**
+     * @brief Makes the built-in pre-processing apply mean values and scales of the input
+     *
+     * If enabled and the mean variant is MEAN_VALUE, every time the built-in pre-processing runs for the input
+     * (resize, color, layout or precision conversion is required), every channel is also normalized as
+     * (x - meanValue) * stdScale in the same pass, so the plugin does not process the input data once again.
+     * The network input precision must be FP32 or BF16 in this case.
+     *
+     * @param fused true to normalize the input as a part of the built-in pre-processing
+     */
+    void setFusedNormalization(bool fused) {
+        _fusedNormalization = fused;
+    }
+
+    /**
+     * @brief Checks whether mean values and scales are applied by the built-in pre-processing
+     *
+     * @return true if normalization is fused into the built-in pre-processing and the mean variant is MEAN_VALUE
+     */
+    bool getFusedNormalization() const {
+        return _fusedNormalization && _variant == MEAN_VALUE;
+    }
 };
 }  // namespace InferenceEngine
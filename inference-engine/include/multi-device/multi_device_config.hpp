@@ -26,6 +26,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +40,17 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how inference requests are distributed among the devices
+ *
+ * MULTI_POLICY_PRIORITY (default) - devices are always tried in the order of priorities, so a device gets
+ * requests only if all devices with higher priorities are busy
+ * MULTI_POLICY_EARLIEST_COMPLETION - a request is given to the device which is expected to complete it first
+ * according to the moving average latency and the number of requests in flight of the devices
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(POLICY_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(POLICY_EARLIEST_COMPLETION);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
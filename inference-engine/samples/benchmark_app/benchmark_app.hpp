@@ -37,6 +37,16 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop request rate
+static const char rate_message[] = "Optional. Target rate of inference requests per second for an open-loop load. "
+                                   "Requests are submitted at this rate independently of completions and wait in a queue "
+                                   "while all infer requests are busy, the waiting time is reported as queueing delay. "
+                                   "Default value is 0, which keeps all infer requests busy (closed loop). Async API only.";
+
+/// @brief message for arrival process of the open-loop load
+static const char arrival_message[] = "Optional. Arrival process of the open-loop load: \"fixed\" intervals (default) "
+                                      "or \"poisson\" with exponentially distributed intervals.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -53,6 +63,9 @@ static const char infer_num_streams_message[] = "Optional. Number of streams to
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] = "Optional. Enforcing of floating point operations execution in bfloat16 precision where it is acceptable.";
 
+/// @brief message for inter-op parallel execution on the CPU
+static const char inter_op_message[] = "Optional. Execute independent branches of the network concurrently within a CPU stream.";
+
 /// @brief message for user library argument
 static const char custom_cpu_library_message[] = "Required for CPU custom layers. Absolute path to a shared library with the kernels implementations.";
 
@@ -78,6 +91,9 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
                                           "extends \"average_counters\" report and additionally includes per-layer PM "
                                           "counters and latency for each executed infer request.";
 
+// @brief message for report_format option
+static const char report_format_message[] = "Optional. Format of the statistics report: \"csv\" (default) or \"json\".";
+
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
@@ -144,6 +160,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target rate of inference requests per second, 0 means closed loop
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Arrival process of the open-loop load
+DEFINE_string(arrival, "fixed", arrival_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -153,6 +175,9 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
+/// @brief Enables concurrent execution of independent graph branches on the CPU
+DEFINE_bool(inter_op, false, inter_op_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -166,6 +191,9 @@ DEFINE_bool(stream_output, false, stream_output_message);
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
+/// @brief Format of the statistics report
+DEFINE_string(report_format, "csv", report_format_message);
+
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
@@ -213,15 +241,19 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -arrival \"fixed\"/\"poisson\" " << arrival_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -enforcebf16              " << enforce_bf16_message << std::endl;
+    std::cout << "    -inter_op                 " << inter_op_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"/\"NUMA\"    " << infer_threads_pinning_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
+    std::cout << "    -report_format \"<format>\" " << report_format_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
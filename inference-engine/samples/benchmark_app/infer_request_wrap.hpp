@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueDelay)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
 class InferReqWrap final {
@@ -37,12 +37,18 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
-                    _callbackQueue(_id, getExecutionTimeInMilliseconds());
+                    _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueTimeInMilliseconds());
                 });
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request for a submission which arrived at arrivalTime and waited for an idle request since then
+    void startAsync(const Time::time_point& arrivalTime) {
         _startTime = Time::now();
+        _arrivalTime = (std::min)(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,9 +58,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueTimeInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -70,8 +77,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueTimeInMilliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -84,7 +97,8 @@ public:
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this,
                                                                                  std::placeholders::_1,
-                                                                                 std::placeholders::_2)));
+                                                                                 std::placeholders::_2,
+                                                                                 std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -102,6 +116,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueDelays.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -109,9 +124,11 @@ public:
     }
 
     void putIdleRequest(size_t id,
-                        const double latency) {
+                        const double latency,
+                        const double queueDelay) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueDelays.push_back(queueDelay);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,6 +152,10 @@ public:
         return _latencies;
     }
 
+    std::vector<double> getQueueDelays() {
+        return _queueDelays;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +165,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueDelays;
 };
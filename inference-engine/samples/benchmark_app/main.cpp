@@ -4,9 +4,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -67,6 +70,23 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_report_format != csvReportFormat && FLAGS_report_format != jsonReportFormat) {
+        throw std::logic_error("only " + std::string(csvReportFormat) + "/" + std::string(jsonReportFormat) +
+                               " report formats are supported (invalid -report_format option value)");
+    }
+
+    if (FLAGS_rate < 0.0) {
+        throw std::logic_error("Incorrect rate. Please set -rate option to a non-negative value.");
+    }
+
+    if (FLAGS_rate > 0.0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load (-rate option) is supported for the async API only.");
+    }
+
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `fixed` or `poisson` value.");
+    }
+
     return true;
 }
 
@@ -94,14 +114,8 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
+static const std::vector<double> latencyPercentiles = {50.0, 90.0, 99.0, 99.9};
+static const size_t latencyHistogramBins = 20;
 
 /**
 * @brief The entry point of the benchmark application
@@ -132,7 +146,7 @@ int main(int argc, char *argv[]) {
             }
         }
         if (!FLAGS_report_type.empty()) {
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder, FLAGS_report_format});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
         auto isFlagSetInCommandLine = [&command_line_arguments] (const std::string& name) {
@@ -248,6 +262,9 @@ int main(int argc, char *argv[]) {
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
+                if (isFlagSetInCommandLine("inter_op"))
+                    device_config[CONFIG_KEY(CPU_INTER_OP_PARALLEL)] = FLAGS_inter_op ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+
                 if (isFlagSetInCommandLine("pin")) {
                     // set to user defined value
                     device_config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin;
@@ -330,10 +347,13 @@ int main(int argc, char *argv[]) {
             CNNNetwork cnnNetwork = ie.ReadNetwork(FLAGS_m);
             auto duration_ms = double_to_string(get_total_ms_time(startTime));
             slog::info << "Read network took " << duration_ms << " ms" << slog::endl;
+            auto peakMemoryMb = double_to_string(getPeakMemoryUsageKb() / 1024.0);
+            slog::info << "Peak memory usage after reading network: " << peakMemoryMb << " MB" << slog::endl;
             if (statistics)
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
-                                                  {"read network time (ms)", duration_ms}
+                                                  {"read network time (ms)", duration_ms},
+                                                  {"read network peak memory (MB)", peakMemoryMb}
                                           });
 
             const InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
@@ -438,9 +458,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Open loop submits requests at the target rate instead of keeping all infer requests busy
+        const bool openLoop = FLAGS_rate > 0.0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -471,6 +494,13 @@ int main(int argc, char *argv[]) {
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"target rate (requests/s)", double_to_string(FLAGS_rate)},
+                                                  {"arrival process", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -500,6 +530,9 @@ int main(int argc, char *argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (openLoop) {
+                ss << " at " << double_to_string(FLAGS_rate) << " requests/s with " << FLAGS_arrival << " arrivals";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -549,13 +582,26 @@ int main(int argc, char *argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // Arrivals of the open loop, the generator is seeded with a constant to make runs reproducible
+        std::mt19937 arrivalGenerator;
+        std::exponential_distribution<double> poissonInterval(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrivalInterval = [&] () {
+            const double seconds = (FLAGS_arrival == "poisson") ? poissonInterval(arrivalGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                // the request is queued from its arrival until some infer request becomes idle
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -570,7 +616,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivalTime += nextArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -589,14 +640,57 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Arrivals of a time limited open loop which were still waiting for an idle infer request
+        // when the time was over, they are not executed and so not counted in latencies
+        size_t droppedArrivals = 0;
+        if (openLoop && niter == 0) {
+            const auto stopTime = Time::now();
+            for (; arrivalTime <= stopTime; arrivalTime += nextArrivalInterval()) {
+                droppedArrivals++;
+            }
+        }
+
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        const std::vector<double> executionTimes = inferRequestsQueue.getLatencies();
+        const std::vector<double> queueDelays = inferRequestsQueue.getQueueDelays();
+        std::vector<double> totalLatencies(executionTimes.size());
+        std::transform(executionTimes.begin(), executionTimes.end(), queueDelays.begin(), totalLatencies.begin(),
+                       std::plus<double>());
+        const LatencyMetrics executionLatency(executionTimes);
+        const LatencyMetrics queueLatency(queueDelays);
+        const LatencyMetrics totalLatency(totalLatencies);
+
+        double latency = executionLatency.median();
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
 
+        auto percentile_name = [] (const std::string& prefix, double percentile) {
+            std::stringstream ss;
+            ss << prefix << " p" << percentile << " (ms)";
+            return ss.str();
+        };
+        auto latency_parameters = [&] (const std::string& prefix, const LatencyMetrics& metrics) {
+            StatisticsReport::Parameters parameters = {
+                    {prefix + " average (ms)", double_to_string(metrics.average())},
+                    {prefix + " min (ms)", double_to_string(metrics.minimum())},
+                    {prefix + " max (ms)", double_to_string(metrics.maximum())},
+            };
+            for (auto percentile : latencyPercentiles) {
+                parameters.push_back({percentile_name(prefix, percentile), double_to_string(metrics.percentile(percentile))});
+            }
+            return parameters;
+        };
+        auto latency_percentiles = [&] (const LatencyMetrics& metrics) {
+            std::stringstream ss;
+            for (auto percentile : latencyPercentiles) {
+                ss << (ss.str().empty() ? "" : ", ") << "p" << percentile << " " << double_to_string(metrics.percentile(percentile));
+            }
+            return ss.str() + " ms";
+        };
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -608,11 +702,37 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          latency_parameters("execution time", executionLatency));
+                if (openLoop) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              latency_parameters("queueing delay", queueLatency));
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              latency_parameters("total latency", totalLatency));
+                }
+
+                // queueing delay is zero in the closed loop, so the total latency is the execution time there
+                const auto histogram = totalLatency.histogram(latencyHistogramBins);
+                const double binWidth = (totalLatency.maximum() - totalLatency.minimum()) / latencyHistogramBins;
+                StatisticsReport::Parameters histogramParameters;
+                for (size_t bin = 0; bin < histogram.size(); bin++) {
+                    histogramParameters.push_back({double_to_string(totalLatency.minimum() + bin * binWidth) + " - " +
+                                                   double_to_string(totalLatency.minimum() + (bin + 1) * binWidth) + " ms",
+                                                   std::to_string(histogram[bin])});
+                }
+                statistics->addParameters(StatisticsReport::Category::LATENCY_HISTOGRAM, histogramParameters);
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
                                               {"throughput", double_to_string(fps)}
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"achieved rate (requests/s)", double_to_string(1000.0 * iteration / totalDuration)},
+                                                  {"dropped arrivals", std::to_string(droppedArrivals)},
+                                          });
+            }
         }
 
         progressBar.finish();
@@ -657,9 +777,22 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "            " << latency_percentiles(executionLatency) << std::endl;
+            if (openLoop) {
+                std::cout << "Queueing:   " << latency_percentiles(queueLatency) << std::endl;
+                std::cout << "Total:      " << latency_percentiles(totalLatency) << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoop) {
+            std::cout << "Rate:       " << double_to_string(1000.0 * iteration / totalDuration) << " requests/s (target "
+                      << double_to_string(FLAGS_rate) << " requests/s)" << std::endl;
+            if (droppedArrivals > 0) {
+                std::cout << "Dropped:    " << droppedArrivals << " arrivals were still queued when the time was over" << std::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -7,9 +7,58 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
 
 #include "statistics_report.hpp"
 
+LatencyMetrics::LatencyMetrics(std::vector<double> values) : _values(std::move(values)) {
+    std::sort(_values.begin(), _values.end());
+}
+
+double LatencyMetrics::minimum() const {
+    return _values.empty() ? 0.0 : _values.front();
+}
+
+double LatencyMetrics::maximum() const {
+    return _values.empty() ? 0.0 : _values.back();
+}
+
+double LatencyMetrics::average() const {
+    return _values.empty() ? 0.0 : std::accumulate(_values.begin(), _values.end(), 0.0) / _values.size();
+}
+
+double LatencyMetrics::median() const {
+    if (_values.empty())
+        return 0.0;
+    const size_t middle = _values.size() / 2;
+    return (_values.size() % 2 != 0) ? _values[middle] : (_values[middle] + _values[middle - 1]) / 2.0;
+}
+
+double LatencyMetrics::percentile(double p) const {
+    if (_values.empty())
+        return 0.0;
+    // the smallest sample which is not less than p percent of all samples, the epsilon absorbs rounding of p / 100
+    const double rank = std::ceil(p / 100.0 * _values.size() - 1e-9);
+    const size_t index = rank < 1.0 ? 0 : (std::min)(static_cast<size_t>(rank) - 1, _values.size() - 1);
+    return _values[index];
+}
+
+std::vector<size_t> LatencyMetrics::histogram(size_t bins) const {
+    std::vector<size_t> counts(bins, 0);
+    if (_values.empty() || bins == 0)
+        return counts;
+    const double width = (maximum() - minimum()) / bins;
+    for (auto value : _values) {
+        size_t bin = width > 0.0 ? static_cast<size_t>((value - minimum()) / width) : 0;
+        counts[(std::min)(bin, bins - 1)]++;
+    }
+    return counts;
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -17,7 +66,21 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+static const std::vector<std::pair<StatisticsReport::Category, std::string>> categoryNames = {
+    {StatisticsReport::Category::COMMAND_LINE_PARAMETERS, "Command line parameters"},
+    {StatisticsReport::Category::RUNTIME_CONFIG, "Configuration setup"},
+    {StatisticsReport::Category::EXECUTION_RESULTS, "Execution results"},
+    {StatisticsReport::Category::LATENCY_HISTOGRAM, "Latency histogram"},
+};
+
 void StatisticsReport::dump() {
+    if (_config.report_format == jsonReportFormat)
+        dumpJson();
+    else
+        dumpCsv();
+}
+
+void StatisticsReport::dumpCsv() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
     auto dump_parameters = [ &dumper ] (const Parameters &parameters) {
@@ -26,31 +89,117 @@ void StatisticsReport::dump() {
             dumper.endLine();
         }
     };
-    if (_parameters.count(Category::COMMAND_LINE_PARAMETERS)) {
-        dumper << "Command line parameters";
+    for (auto& category : categoryNames) {
+        if (_parameters.count(category.first) == 0)
+            continue;
+        dumper << category.second;
         dumper.endLine();
 
-        dump_parameters(_parameters.at(Category::COMMAND_LINE_PARAMETERS));
+        dump_parameters(_parameters.at(category.first));
         dumper.endLine();
     }
 
-    if (_parameters.count(Category::RUNTIME_CONFIG)) {
-        dumper << "Configuration setup";
-        dumper.endLine();
+    slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+}
 
-        dump_parameters(_parameters.at(Category::RUNTIME_CONFIG));
-        dumper.endLine();
+static std::string jsonString(const std::string& value) {
+    std::string escaped = "\"";
+    for (char c : value) {
+        switch (c) {
+            case '"':  escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[7];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<int>(c));
+                    escaped += code;
+                } else {
+                    escaped += c;
+                }
+        }
     }
+    return escaped + "\"";
+}
 
-    if (_parameters.count(Category::EXECUTION_RESULTS)) {
-        dumper << "Execution results";
-        dumper.endLine();
+// checks the number grammar of JSON: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+static bool isJsonNumber(const std::string& value) {
+    auto isDigit = [] (char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; };
+    size_t i = 0;
+    auto digits = [&] () {
+        const size_t begin = i;
+        while (i < value.size() && isDigit(value[i]))
+            i++;
+        return i - begin;
+    };
 
-        dump_parameters(_parameters.at(Category::EXECUTION_RESULTS));
-        dumper.endLine();
+    if (i < value.size() && value[i] == '-')
+        i++;
+    if (i < value.size() && value[i] == '0') {
+        i++;
+    } else if (digits() == 0) {
+        return false;
+    }
+    if (i < value.size() && value[i] == '.') {
+        i++;
+        if (digits() == 0)
+            return false;
+    }
+    if (i < value.size() && (value[i] == 'e' || value[i] == 'E')) {
+        i++;
+        if (i < value.size() && (value[i] == '+' || value[i] == '-'))
+            i++;
+        if (digits() == 0)
+            return false;
     }
+    return i == value.size();
+}
 
-    slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+// numbers are kept as numbers, so the report can be consumed without post-processing
+static std::string jsonValue(const std::string& value) {
+    return isJsonNumber(value) ? value : jsonString(value);
+}
+
+static std::string jsonKey(const std::string& name) {
+    std::string key;
+    for (char c : name) {
+        if (std::isalnum(static_cast<unsigned char>(c)))
+            key += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        else if (!key.empty() && key.back() != '_')
+            key += '_';
+    }
+    if (!key.empty() && key.back() == '_')
+        key.pop_back();
+    return key;
+}
+
+void StatisticsReport::dumpJson() {
+    const std::string filename = _config.report_folder + _separator + "benchmark_report.json";
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open " + filename + " for writing");
+    }
+
+    file << "{";
+    bool firstCategory = true;
+    for (auto& category : categoryNames) {
+        if (_parameters.count(category.first) == 0)
+            continue;
+        file << (firstCategory ? "" : ",") << "\n  " << jsonString(jsonKey(category.second)) << ": {";
+        firstCategory = false;
+
+        bool firstParameter = true;
+        for (auto& parameter : _parameters.at(category.first)) {
+            file << (firstParameter ? "" : ",") << "\n    " << jsonString(parameter.first) << ": " << jsonValue(parameter.second);
+            firstParameter = false;
+        }
+        file << "\n  }";
+    }
+    file << "\n}\n";
+
+    slog::info << "Statistics report is stored to " << filename << slog::endl;
 }
 
 void StatisticsReport::dumpPerformanceCountersRequest(CsvDumper& dumper,
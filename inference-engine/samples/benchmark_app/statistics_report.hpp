@@ -19,7 +19,43 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
-/// @brief Responsible for collecting of statistics and dumping to .csv file
+// @brief statistics reports formats
+static constexpr char csvReportFormat[] = "csv";
+static constexpr char jsonReportFormat[] = "json";
+
+/// @brief Order statistics and histogram of latency samples in milliseconds
+class LatencyMetrics {
+public:
+    explicit LatencyMetrics(std::vector<double> values);
+
+    bool empty() const {
+        return _values.empty();
+    }
+
+    size_t count() const {
+        return _values.size();
+    }
+
+    double minimum() const;
+
+    double maximum() const;
+
+    double average() const;
+
+    /// @brief Median, the mean of two middle samples for an even count
+    double median() const;
+
+    /// @brief Nearest-rank percentile, p is in (0, 100]
+    double percentile(double p) const;
+
+    /// @brief Numbers of samples in bins of equal width between the minimum and the maximum
+    std::vector<size_t> histogram(size_t bins) const;
+
+private:
+    std::vector<double> _values;
+};
+
+/// @brief Responsible for collecting of statistics and dumping to .csv or .json file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
@@ -28,12 +64,14 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        std::string report_format;
     };
 
     enum class Category {
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_HISTOGRAM,
     };
 
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
@@ -58,6 +96,10 @@ public:
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
 private:
+    void dumpCsv();
+
+    void dumpJson();
+
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
 
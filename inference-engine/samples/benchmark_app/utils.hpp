@@ -18,6 +18,11 @@ bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info);
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
 
+/**
+ * @brief Returns peak resident set size of the current process in kilobytes, or 0 if it is not available
+ */
+size_t getPeakMemoryUsageKb();
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
                  const std::map<std::string, std::map<std::string, std::string>>& config);
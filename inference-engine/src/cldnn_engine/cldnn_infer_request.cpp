@@ -523,9 +523,7 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
             if (preProcessingRequired(foundInput, data)) {
                 // Stores the given blob as ROI blob. It will be used to fill in network input
                 // during pre-processing
-                _preProcData[name] = CreatePreprocDataHelper();
-                _preProcData[name]->isApplicable(data, _inputs[name]);
-                _preProcData[name]->setRoiBlob(data);
+                addInputPreProcessingFor(name, data, _inputs[name]);
             } else {
                 if (compoundBlobPassed) {
                     THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << cannot_set_compound;
@@ -25,6 +25,8 @@
 #include <gna/gna_config.hpp>
 #include "gna_plugin_config.hpp"
 #include <legacy/ie_util_internal.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <ie_parallel.hpp>
 #include "gna_plugin.hpp"
 #include "optimizer/gna_pass_manager.hpp"
 #include "layers/gna_layer_type.hpp"
@@ -782,15 +784,32 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #endif
     }
 
+    if (gnaFlags->sw_fp32) {
+        fpRuntimes.clear();
+        fpRuntimes.push_back(std::make_shared<runtime::FP>(dnn));
+        fpInferences.resize(gnaFlags->gna_lib_async_threads_num);
+        // each parallel request gets own stream, float kernels use threads of the stream
+        auto streams = static_cast<int>(gnaFlags->gna_lib_async_threads_num);
+        fpExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"GNAFloatRuntime",
+                                     streams,
+                                     std::max(1, parallel_get_max_threads() / streams),
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
     // creating same gna RW segment for parallel infer requests
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
-        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
+            // this can be improved by just copy all structures, but we are too lazy
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        }
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        }
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -813,6 +832,13 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // float runtime of this request works on own copy of components
+            fpRuntimes.push_back(std::make_shared<runtime::FP>(dnn));
+            fpRuntimes.back()->relocate(reinterpret_cast<uint8_t *>(gnamem->getBasePtr()), rwSegmentSize, basePtr);
+            continue;
+        }
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -894,7 +920,9 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        for (int i = 0; i != gnaFlags->gna_lib_async_threads_num; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -1108,8 +1136,19 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
     if (!gnadevice) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
+        if (fpRuntimes.size() <= idx || nullptr == fpExecutor) {
+            auto runtime = runtime::FP(dnn);
+            runtime.infer();
+        } else {
+            auto fpRuntime = fpRuntimes[idx];
+            auto task = std::make_shared<std::packaged_task<void()>>([fpRuntime] {
+                fpRuntime->infer();
+            });
+            fpInferences[idx] = task->get_future();
+            fpExecutor->run([task] {
+                (*task)();
+            });
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -1161,6 +1200,17 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         if (waitStatus == GNA_REQUEST_PENDING) {
             return GNA_REQUEST_PENDING;
         }
+    } else if (request_idx < fpInferences.size() && fpInferences[request_idx].valid()) {
+        auto &inference = fpInferences[request_idx];
+        if (inference.wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        try {
+            inference.get();
+        } catch (...) {
+            std::get<1>(nnets[request_idx]) = -1;
+            throw;
+        }
     }
 
     std::get<1>(nnets[request_idx]) = -1;
@@ -12,7 +12,9 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
@@ -23,6 +25,7 @@
 #include "gna_plugin_policy.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_plugin_config.hpp"
+#include "runtime/gna_float_runtime.hpp"
 
 #if GNA_LIB_VER == 2
 #include <gna2-model-api.h>
@@ -85,6 +88,14 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief - float runtimes of GNA_SW_FP32 mode working on RW segments of parallel infer requests
+     * and their running inferences
+     */
+    std::vector<std::shared_ptr<GNAPluginNS::runtime::FP>> fpRuntimes;
+    std::vector<std::future<void>> fpInferences;
+    InferenceEngine::ITaskExecutor::Ptr fpExecutor;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::VariableStateInternal::Ptr> memoryStates;
@@ -196,10 +196,6 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
             THROW_GNA_EXCEPTION << as_status << NOT_FOUND << "Incorrect GNA Plugin config. Key " << item.first
                                 << " not supported";
         }
-
-        if (gnaFlags.sw_fp32 && gnaFlags.gna_lib_async_threads_num > 1) {
-            THROW_GNA_EXCEPTION << "GNA plugin does not support async mode on GNA_SW_FP32!";
-        }
     }
 
     if (inputScaleFactors.empty()) {
@@ -6,10 +6,17 @@
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 
+namespace {
+// float kernels split work between threads only when it amortizes scheduling
+constexpr size_t kParallelWorkThreshold = 16 * 1024;
+}  // namespace
+
 
 void CNNFilter32(intel_dnn_component_t *component) {
     float *ptr_filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
@@ -30,15 +37,20 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    auto filter_output = [&](uint32_t j) {
+        const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+            ptr_outputs[j * num_filters + i] = ptr_biases[i] + sdot(num_filter_coefficients, ptr_in, ptr_coef);
+        }
+    };
+
+    if (static_cast<size_t>(num_filter_outputs) * num_filters * num_filter_coefficients >= kParallelWorkThreshold) {
+        InferenceEngine::parallel_for(num_filter_outputs, filter_output);
+    } else {
+        for (uint32_t j = 0; j < num_filter_outputs; j++) {
+            filter_output(j);
         }
     }
 }
@@ -100,29 +112,38 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
         uint32_t num_pool_step = component->op.maxpool.num_inputs_step;
         uint32_t num_rows_in = num_inputs / component->op.maxpool.num_inputs_stride;
 
-        for (uint32_t i = 0; i < num_columns; i++) {
-            int32_t m = 0;
-            if (component->op.maxpool.do_sum_not_max) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * num_columns + i];
+        const bool do_sum = component->op.maxpool.do_sum_not_max;
+        const uint32_t num_windows = (num_rows_in + num_pool_step - 1) / num_pool_step;
+
+        // each window reduces whole rows, so inner loops go over contiguous columns and vectorize
+        auto pool_window = [&](uint32_t m) {
+            uint32_t j = m * num_pool_step;
+            uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+            float *ptr_out = ptr_outputs + m * num_columns;
+            const float init = do_sum ? 0.0f : -1e20f;
+            for (uint32_t i = 0; i < num_columns; i++) {
+                ptr_out[i] = init;
+            }
+            for (uint32_t k = j; k < num_end; k++) {
+                const float *ptr_in = ptr_inputs + k * num_columns;
+                if (do_sum) {
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] += ptr_in[i];
                     }
-                    ptr_outputs[m * num_columns + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * num_columns + i] > max) max = ptr_inputs[k * num_columns + i];
+                } else {
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] = (ptr_in[i] > ptr_out[i]) ? ptr_in[i] : ptr_out[i];
                     }
-                    ptr_outputs[m * num_columns + i] = max;
-                    m++;
                 }
             }
+        };
+
+        if (static_cast<size_t>(num_inputs) * num_pool_size / num_pool_step >= kParallelWorkThreshold) {
+            InferenceEngine::parallel_for(num_windows, pool_window);
+        } else {
+            for (uint32_t m = 0; m < num_windows; m++) {
+                pool_window(m);
+            }
         }
     }
 }
@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime/cpu_x86_avx2/floatmath_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, FMA
+
+namespace GNAPluginNS {
+namespace runtime {
+
+float sdot_avx2(uint32_t N, const float *A, const float *B) {
+    // four independent accumulators hide latency of FMA
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps();
+    __m256 acc3 = _mm256_setzero_ps();
+    uint32_t k = 0;
+    for (; k + 32 <= N; k += 32) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(A + k), _mm256_loadu_ps(B + k), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(A + k + 8), _mm256_loadu_ps(B + k + 8), acc1);
+        acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(A + k + 16), _mm256_loadu_ps(B + k + 16), acc2);
+        acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(A + k + 24), _mm256_loadu_ps(B + k + 24), acc3);
+    }
+    for (; k + 8 <= N; k += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(A + k), _mm256_loadu_ps(B + k), acc0);
+    }
+    __m256 acc = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    sum4 = _mm_add_ss(sum4, _mm_movehdup_ps(sum4));
+    float sum = _mm_cvtss_f32(sum4);
+    for (; k < N; k++) {
+        sum += A[k] * B[k];
+    }
+    return sum;
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
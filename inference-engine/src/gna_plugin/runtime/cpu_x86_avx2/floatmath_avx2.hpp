@@ -0,0 +1,18 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief dot product of two float vectors manually vectored for AVX2 and FMA (w/o threads)
+ */
+float sdot_avx2(uint32_t N, const float *A, const float *B);
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -1,13 +1,47 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines for reference FP32 runtime
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
 
 #include "floatmath.h"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+
+namespace {
+// rows of output are computed in parallel only when there is enough work to amortize scheduling
+constexpr size_t kParallelWorkThreshold = 16 * 1024;
+
+// copies K x N matrix B (row stride ldb) into N x K contiguous buffer, so its columns can be used in sdot
+inline const float *transpose_columns(const float *B, int K, int N, int ldb, std::vector<float> &buffer) {
+    buffer.resize(static_cast<size_t>(K) * N);
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            buffer[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+        }
+    }
+    return buffer.data();
+}
+
+template <typename F>
+inline void for_rows(int rows, size_t work, const F &body) {
+    if (work >= kParallelWorkThreshold) {
+        InferenceEngine::parallel_for(rows, body);
+    } else {
+        for (int i = 0; i < rows; i++) {
+            body(i);
+        }
+    }
+}
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -19,44 +53,37 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    const size_t work = static_cast<size_t>(M) * N * K;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
+        thread_local std::vector<float> columns;
+        auto Bt = transpose_columns(B, K, N, ldb, columns);
+        for_rows(M, work, [&](int i) {
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+                C[i * ldc + j] = sum + sdot(K, A + i * lda, Bt + j * K);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+        for_rows(M, work, [&](int i) {
+            for (int j = 0; j < N; j++) {
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
+        for_rows(M, work, [&](int i) {
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
+                for (int k = 0; k < K; k++) {
                     sum += A[k * lda + i] * B[k * ldb + j];
                 }
                 C[i * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,53 +124,73 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
+    const size_t work = static_cast<size_t>(L) * N * K;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
+        thread_local std::vector<float> columns;
+        auto Bt = transpose_columns(B, K, N, ldb, columns);
+        for_rows(L, work, [&](int l) {
+            int i = OutputList[l];
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+                C[l * ldc + j] = sum + sdot(K, A + i * lda, Bt + j * K);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+        for_rows(M, work, [&](int i) {
+            for (int l = 0; l < L; l++) {
+                int j = OutputList[l];
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
+        for_rows(L, work, [&](int l) {
+            int i = OutputList[l];
+            for (int j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
+                for (int k = 0; k < K; k++) {
                     sum += A[k * lda + i] * B[k * ldb + j];
                 }
                 C[l * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
     }
 }
 
+float sdot(const uint32_t N, const float *A, const float *B) {
+#ifdef HAVE_AVX2
+    static const bool use_avx2 = InferenceEngine::with_cpu_x86_avx2();
+    if (use_avx2) {
+        return GNAPluginNS::runtime::sdot_avx2(N, A, B);
+    }
+#endif  // HAVE_AVX2
+
+    // independent partial sums let the compiler vectorize the loop
+    constexpr uint32_t kLanes = 8;
+    float acc[kLanes] = {};
+    uint32_t k = 0;
+    for (; k + kLanes <= N; k += kLanes) {
+        for (uint32_t l = 0; l < kLanes; l++) {
+            acc[l] += A[k + l] * B[k + l];
+        }
+    }
+    float sum = 0.0f;
+    for (; k < N; k++) {
+        sum += A[k] * B[k];
+    }
+    for (uint32_t l = 0; l < kLanes; l++) {
+        sum += acc[l];
+    }
+    return sum;
+}
+
 // C = [ A1 A2 ] * X + B
 void sgemv_split(const uint32_t N,
                  const uint32_t K1,
@@ -155,18 +202,11 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    for_rows(num_rows, static_cast<size_t>(num_rows) * num_columns, [&](int i) {
+        const float *x = X + static_cast<size_t>(i) * num_columns;
+        C[i] = B[i] + sdot(K1, A1, x) + sdot(K2, A2, x + K1);
+    });
 }
 
 #ifdef __cplusplus
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 
@@ -50,6 +51,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L);
+float sdot(const uint32_t N, const float *A, const float *B);
 void sgemv_split(const uint32_t N,
                  const uint32_t K1,
                  const uint32_t K2,
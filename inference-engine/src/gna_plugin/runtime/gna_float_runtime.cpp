@@ -17,17 +17,17 @@ void FP::infer() {
         THROW_GNA_EXCEPTION << "[GNA FP32 RUNTIME] not initialized";
     }
 
-    for (uint32_t i = 0; i < dnn->component.size(); i++) {
-        intel_dnn_component_t *comp = &dnn->component[i];
+    for (uint32_t i = 0; i < components.size(); i++) {
+        intel_dnn_component_t *comp = &components[i];
         uint32_t *ptr_active_outputs = nullptr;
         uint32_t num_active_outputs = (comp->orientation_out == kDnnInterleavedOrientation)
                                       ? comp->num_rows_out : comp->num_columns_out;
 
-        if (i == dnn->component.size() - 1) {  // active list applies to last component
+        if (i == components.size() - 1) {  // active list applies to last component
             ptr_active_outputs = dnn->ptr_active_outputs();
             num_active_outputs = dnn->num_active_outputs();
-        } else if (i == dnn->component.size() - 2) {  // also applies to last two components when last is PWL
-            if ((dnn->component[i].operation == kDnnAffineOp) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
+        } else if (i == components.size() - 2) {  // also applies to last two components when last is PWL
+            if ((components[i].operation == kDnnAffineOp) && (components[i + 1].operation == kDnnPiecewiselinearOp)) {
                 ptr_active_outputs = dnn->ptr_active_outputs();
                 num_active_outputs = dnn->num_active_outputs();            }
         }
@@ -42,8 +42,8 @@ void FP::infer() {
                 break;
             }
             case kDnnRecurrentOp: {
-                if ((i < dnn->component.size() - 1) && (dnn->component[i + 1].operation == kDnnPiecewiselinearOp)) {
-                    intel_dnn_component_t *comp_pwl = &dnn->component[i + 1];
+                if ((i < components.size() - 1) && (components[i + 1].operation == kDnnPiecewiselinearOp)) {
+                    intel_dnn_component_t *comp_pwl = &components[i + 1];
                     for (uint32_t j = 0; j < comp->num_rows_in; j++) {
                         void *ptr_feedbacks =
                             reinterpret_cast<void *>(reinterpret_cast<int32_t *>(comp->op.recurrent.ptr_feedbacks)
@@ -85,4 +85,36 @@ void FP::infer() {
                 THROW_GNA_EXCEPTION << "[GNA FP32 RUNTIME] Bad operation " << comp->operation;
         }
     }
-}
\ No newline at end of file
+}
+
+void FP::relocate(const uint8_t *rwBase, size_t rwSize, uint8_t *newRwBase) {
+    auto relocatePtr = [&](void *&ptr) {
+        auto bytePtr = reinterpret_cast<uint8_t *>(ptr);
+        if (bytePtr >= rwBase && bytePtr < rwBase + rwSize) {
+            ptr = newRwBase + (bytePtr - rwBase);
+        }
+    };
+
+    for (auto &&comp : components) {
+        relocatePtr(comp.ptr_inputs);
+        relocatePtr(comp.ptr_outputs);
+        switch (comp.operation) {
+            case kDnnAffineOp:
+            case kDnnDiagonalOp:
+                relocatePtr(comp.op.affine.ptr_weights);
+                relocatePtr(comp.op.affine.ptr_biases);
+                break;
+            case kDnnRecurrentOp:
+                relocatePtr(comp.op.recurrent.ptr_feedbacks);
+                relocatePtr(comp.op.recurrent.ptr_weights);
+                relocatePtr(comp.op.recurrent.ptr_biases);
+                break;
+            case kDnnConvolutional1dOp:
+                relocatePtr(comp.op.conv1D.ptr_filters);
+                relocatePtr(comp.op.conv1D.ptr_biases);
+                break;
+            default:
+                break;
+        }
+    }
+}
@@ -3,6 +3,9 @@
 //
 
 #pragma once
+
+#include <memory>
+#include <vector>
 #include <backend/am_intel_dnn.hpp>
 
 namespace GNAPluginNS {
@@ -12,11 +15,18 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    // copy of dnn components, so parallel infer requests can use own read-write memory
+    std::vector<intel_dnn_component_t> components;
  public:
-    FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn), components(dnn ? dnn->component : decltype(components){}) {
     }
     virtual void infer();
 
+    /**
+     * @brief moves pointers to read-write memory [rwBase, rwBase + rwSize) to the same offsets from newRwBase
+     */
+    void relocate(const uint8_t *rwBase, size_t rwSize, uint8_t *newRwBase);
+
     /**
      * atomic operations for floating inference
      */
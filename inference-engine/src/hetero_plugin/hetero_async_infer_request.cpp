@@ -4,6 +4,7 @@
 
 #include <utility>
 #include <memory>
+#include <exception>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -16,6 +17,49 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)),
     _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
     _pipeline.clear();
+    if (nullptr != _heteroInferRequest->_pipeline) {
+        // stages take requests from the pools shared by all infer requests of the executable network
+        auto heteroPipeline = _heteroInferRequest->_pipeline;
+        auto lastStageId = _heteroInferRequest->_inferRequests.size() - 1;
+        for (std::size_t stageId = 0; stageId <= lastStageId; ++stageId) {
+            struct StageExecutor : ITaskExecutor {
+                StageExecutor(HeteroInferRequest* heteroInferRequest, std::size_t stageId) :
+                    _heteroInferRequest{heteroInferRequest}, _stageId{stageId} {}
+                void run(Task task) override {
+                    _task = std::move(task);
+                    _heteroInferRequest->_pipeline->StartAsync(_stageId,
+                        [this] (const InferRequest::Ptr& request) {
+                            _heteroInferRequest->prepareStage(_stageId, request);
+                        },
+                        [this] (const InferRequest::Ptr& request) {
+                            _heteroInferRequest->completeStage(_stageId, request);
+                        },
+                        [this] (std::exception_ptr error) {
+                            _error = error;
+                            auto capturedTask = std::move(_task);
+                            capturedTask();
+                        });
+                }
+                HeteroInferRequest* _heteroInferRequest = nullptr;
+                std::size_t         _stageId = 0;
+                std::exception_ptr  _error;
+                Task                _task;
+            };
+
+            auto stageExecutor = std::make_shared<StageExecutor>(_heteroInferRequest.get(), stageId);
+            _pipeline.emplace_back(stageExecutor, [stageExecutor, heteroPipeline, stageId, lastStageId] {
+                auto error = std::move(stageExecutor->_error);
+                stageExecutor->_error = nullptr;
+                if (nullptr != error || stageId == lastStageId) {
+                    heteroPipeline->End();
+                }
+                if (nullptr != error) {
+                    std::rethrow_exception(error);
+                }
+            });
+        }
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
@@ -45,6 +89,9 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    if (nullptr != _heteroInferRequest->_pipeline) {
+        _heteroInferRequest->_pipeline->Begin();
+    }
     _heteroInferRequest->updateInOutIfNeeded();
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
@@ -54,8 +101,11 @@ StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch(...) {
-        for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
-            requestDesc._request->Wait(IInferRequest::RESULT_READY);
+        // pooled requests of the pipelined mode are shared, so the failed stage is already finished
+        if (nullptr == _heteroInferRequest->_pipeline) {
+            for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
+                requestDesc._request->Wait(IInferRequest::RESULT_READY);
+            }
         }
         throw;
     }
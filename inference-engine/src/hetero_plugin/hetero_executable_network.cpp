@@ -418,6 +418,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -550,6 +551,21 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+    if (itPipelined == _config.end() || itPipelined->second != YES) {
+        return;
+    }
+    // each subgraph gets as many requests as its device can run in parallel
+    std::vector<HeteroPipeline::StageDesc> stages;
+    for (auto&& network : networks) {
+        auto poolSize = network._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        stages.push_back({network._network, poolSize});
+    }
+    _pipeline = std::make_shared<HeteroPipeline>(stages);
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -655,7 +671,8 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
                                                 inferRequests,
-                                                _blobNameMap);
+                                                _blobNameMap,
+                                                _pipeline);
 }
 
 IInferRequest::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -671,6 +688,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        result = nullptr != _pipeline;
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
@@ -739,6 +758,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
         };
+        if (nullptr != _pipeline) {
+            heteroMetrics.push_back(METRIC_KEY(HETERO_PIPELINE_STATISTICS));
+        }
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -760,6 +782,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -787,6 +810,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (EXEC_NETWORK_METRIC_KEY(HETERO_PIPELINE_STATISTICS) == name) {
+        if (nullptr == _pipeline) {
+            THROW_IE_EXCEPTION << "The " << name << " metric requires " << HETERO_CONFIG_KEY(PIPELINED_EXECUTION)
+                               << " set to " << CONFIG_VALUE(YES);
+        }
+        IE_SET_METRIC_RETURN(HETERO_PIPELINE_STATISTICS, _pipeline->GetStatistics());
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
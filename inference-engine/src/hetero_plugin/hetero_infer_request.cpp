@@ -6,6 +6,7 @@
 #include "hetero_itt.hpp"
 #include <ie_blob.h>
 #include <description_buffer.hpp>
+#include <blob_factory.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
 #include <cassert>
@@ -19,13 +20,48 @@ using namespace InferenceEngine::details;
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList& inferRequests,
-                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) :
+                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+                                       const HeteroPipeline::Ptr& pipeline) :
     InferRequestInternal(networkInputs, networkOutputs),
-    _inferRequests(inferRequests) {
+    _inferRequests(inferRequests),
+    _pipeline(pipeline) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
+    if (nullptr != _pipeline) {
+        // subgraph requests are taken from the pipeline pools, so this request owns all blobs
+        // and sets them to a pooled request each time the subgraph is started
+        _subgraphInputToOutputBlobNames = subgraphInputToOutputBlobNames;
+        auto allocateBlob([&](const std::string& blobName, const TensorDesc& desc) {
+            auto itBlob = _blobs.find(blobName);
+            if (itBlob == _blobs.end()) {
+                auto blob = make_blob_with_precision(desc);
+                blob->allocate();
+                itBlob = _blobs.emplace(blobName, blob).first;
+            }
+            if (InferenceEngine::details::contains(networkInputs, blobName)) {
+                _inputs[blobName] = itBlob->second;
+            } else if (InferenceEngine::details::contains(networkOutputs, blobName)) {
+                _outputs[blobName] = itBlob->second;
+            }
+        });
+        for (auto&& desc : _inferRequests) {
+            for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
+                allocateBlob(outputInfo.first, outputInfo.second->getTensorDesc());
+            }
+        }
+        for (auto&& desc : _inferRequests) {
+            for (auto&& inputInfo : desc._network.GetInputsInfo()) {
+                auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+                if (itName == subgraphInputToOutputBlobNames.end()) {
+                    allocateBlob(inputInfo.first, inputInfo.second->getTensorDesc());
+                }
+            }
+        }
+        return;
+    }
+
     auto requestBlob([&](const std::string& blobName, InferenceEngine::InferRequest::Ptr r) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
@@ -66,6 +102,9 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
 
 void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) {
     InferenceEngine::InferRequestInternal::SetBlob(name, data);
+    if (nullptr != _pipeline) {
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -86,6 +125,26 @@ void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (nullptr != _pipeline) {
+        _pipeline->Begin();
+        try {
+            for (std::size_t stageId = 0; stageId < _inferRequests.size(); ++stageId) {
+                OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _inferRequests[stageId]._profilingTask);
+                _pipeline->Infer(stageId,
+                    [this, stageId] (const InferRequest::Ptr& request) {
+                        prepareStage(stageId, request);
+                    },
+                    [this, stageId] (const InferRequest::Ptr& request) {
+                        completeStage(stageId, request);
+                    });
+            }
+        } catch (...) {
+            _pipeline->End();
+            throw;
+        }
+        _pipeline->End();
+        return;
+    }
     updateInOutIfNeeded();
     for (auto &&desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
@@ -98,7 +157,10 @@ void HeteroInferRequest::InferImpl() {
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     perfMap.clear();
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
+        // pooled requests of the pipelined mode may already run another infer request, so their counters
+        // are taken when the stage completes
+        auto perfMapRequest = (nullptr != _pipeline) ? _inferRequests[i]._perfCounts :
+                                                       _inferRequests[i]._request->GetPerformanceCounts();
         for (auto &&r : perfMapRequest) {
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
@@ -107,6 +169,9 @@ void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
 
 void HeteroInferRequest::updateInOutIfNeeded() {
     OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "updateInOutIfNeeded");
+    if (nullptr != _pipeline) {
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -141,3 +206,35 @@ void HeteroInferRequest::updateInOutIfNeeded() {
         }
     }
 }
+
+void HeteroInferRequest::prepareStage(std::size_t stageId, const InferRequest::Ptr& request) {
+    auto& desc = _inferRequests[stageId];
+    for (auto&& inputInfo : desc._network.GetInputsInfo()) {
+        auto& ioname = inputInfo.first;
+        auto iti = _inputs.find(ioname);
+        if (iti != _inputs.end()) {
+            auto it = _preProcData.find(ioname);
+            auto blob = (it != _preProcData.end()) ? it->second->getRoiBlob() : iti->second;
+            request->SetBlob(ioname, blob, _networkInputs[ioname]->getPreProcess());
+        } else {
+            auto itName = _subgraphInputToOutputBlobNames.find(ioname);
+            IE_ASSERT(itName != _subgraphInputToOutputBlobNames.end());
+            request->SetBlob(ioname, _blobs.at(itName->second));
+        }
+    }
+    for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
+        auto& ioname = outputInfo.first;
+        auto ito = _outputs.find(ioname);
+        request->SetBlob(ioname, (ito != _outputs.end()) ? ito->second : _blobs.at(ioname));
+    }
+}
+
+void HeteroInferRequest::completeStage(std::size_t stageId, const InferRequest::Ptr& request) {
+    auto& desc = _inferRequests[stageId];
+    try {
+        desc._perfCounts = request->GetPerformanceCounts();
+    } catch (const InferenceEngine::details::InferenceEngineException&) {
+        // the device does not report performance counters
+        desc._perfCounts.clear();
+    }
+}
@@ -20,6 +20,8 @@
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
 
+#include "hetero_pipeline.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
@@ -30,13 +32,18 @@ public:
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         openvino::itt::handle_t             _profilingTask;
+        /**
+         * @brief Performance counters of the last pooled request that ran the stage in the pipelined mode
+         */
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfCounts;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests,
-                                const std::unordered_map<std::string, std::string>& blobNameMap);
+                                const std::unordered_map<std::string, std::string>& blobNameMap,
+                                const HeteroPipeline::Ptr& pipeline = nullptr);
 
     void InferImpl() override;
 
@@ -46,8 +53,20 @@ public:
 
     void updateInOutIfNeeded();
 
+    /**
+     * @brief Sets blobs of this request to a pooled infer request of the pipeline stage
+     */
+    void prepareStage(std::size_t stageId, const InferenceEngine::InferRequest::Ptr& request);
+
+    /**
+     * @brief Takes results of a pooled infer request of the pipeline stage before it returns to the pool
+     */
+    void completeStage(std::size_t stageId, const InferenceEngine::InferRequest::Ptr& request);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    HeteroPipeline::Ptr                                 _pipeline;
+    std::unordered_map<std::string, std::string>        _subgraphInputToOutputBlobNames;
 };
 
 }  // namespace HeteroPlugin
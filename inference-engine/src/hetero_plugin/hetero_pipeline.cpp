@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.hpp"
+
+#include <algorithm>
+#include <future>
+#include <string>
+#include <utility>
+
+#include <ie_common.h>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const std::vector<StageDesc>& stages) {
+    for (auto&& desc : stages) {
+        _stages.emplace_back(new Stage);
+        auto& stage = *_stages.back();
+        auto network = desc._network;
+        for (std::size_t i = 0; i < std::max<std::size_t>(desc._poolSize, 1); ++i) {
+            stage._workers.emplace_back(new Worker{network.CreateInferRequestPtr(), {}});
+            auto& worker = *stage._workers.back();
+            worker._request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, &stage, &worker] (InferRequest, StatusCode status) {
+                    OnComplete(stage, worker, status);
+                });
+            stage._idleWorkers.push(&worker);
+        }
+    }
+}
+
+void HeteroPipeline::Begin() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (0 == _inFlight++) {
+        _activeSince = Clock::now();
+    }
+}
+
+void HeteroPipeline::End() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (0 == --_inFlight) {
+        _activeTime += Clock::now() - _activeSince;
+        // idle time of a drained pipeline is not a bubble
+        for (auto&& stage : _stages) {
+            stage->_inBubble = false;
+        }
+    }
+}
+
+void HeteroPipeline::StartAsync(std::size_t stageId, Prepare prepare, Complete complete, Done done) {
+    auto& stage = *_stages.at(stageId);
+    Worker* worker = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (stage._idleWorkers.empty()) {
+            stage._jobs.push_back(Job{std::move(prepare), std::move(complete), std::move(done)});
+            return;
+        }
+        worker = stage._idleWorkers.front();
+        stage._idleWorkers.pop();
+        worker->_job = Job{std::move(prepare), std::move(complete), std::move(done)};
+        Acquired(stage, Clock::now());
+    }
+    Run(stage, *worker);
+}
+
+void HeteroPipeline::Infer(std::size_t stageId, Prepare prepare, Complete complete) {
+    auto promise = std::make_shared<std::promise<void>>();
+    auto future = promise->get_future();
+    StartAsync(stageId, std::move(prepare), std::move(complete), [promise] (std::exception_ptr error) {
+        if (nullptr != error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value();
+        }
+    });
+    future.get();
+}
+
+void HeteroPipeline::Run(Stage& stage, Worker& worker) {
+    while (true) {
+        try {
+            worker._job._prepare(worker._request);
+            worker._request->StartAsync();
+            return;
+        } catch (...) {
+            auto job = std::move(worker._job);
+            auto hasNextJob = Release(stage, worker);
+            job._done(std::current_exception());
+            if (!hasNextJob) {
+                return;
+            }
+        }
+    }
+}
+
+void HeteroPipeline::OnComplete(Stage& stage, Worker& worker, StatusCode status) {
+    std::exception_ptr error;
+    if (StatusCode::OK != status) {
+        try {
+            THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+        } catch (...) {
+            error = std::current_exception();
+        }
+    } else if (worker._job._complete) {
+        try {
+            worker._job._complete(worker._request);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    auto job = std::move(worker._job);
+    auto hasNextJob = Release(stage, worker);
+    job._done(error);
+    if (hasNextJob) {
+        Run(stage, worker);
+    }
+}
+
+void HeteroPipeline::Acquired(Stage& stage, Clock::time_point now) {
+    ++stage._inferences;
+    if (0 == stage._running++) {
+        stage._busySince = now;
+        if (stage._inBubble) {
+            stage._inBubble = false;
+            stage._bubbleTime += now - stage._bubbleSince;
+            ++stage._bubbles;
+        }
+    }
+}
+
+bool HeteroPipeline::Release(Stage& stage, Worker& worker) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto now = Clock::now();
+    if (!stage._jobs.empty()) {
+        // the worker stays busy and takes the oldest waiting job
+        worker._job = std::move(stage._jobs.front());
+        stage._jobs.pop_front();
+        ++stage._inferences;
+        return true;
+    }
+    stage._idleWorkers.push(&worker);
+    if (0 == --stage._running) {
+        stage._busyTime += now - stage._busySince;
+        if (_inFlight > 0) {
+            stage._inBubble = true;
+            stage._bubbleSince = now;
+        }
+    }
+    return false;
+}
+
+std::map<std::string, float> HeteroPipeline::GetStatistics() const {
+    using Milliseconds = std::chrono::duration<float, std::milli>;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto now = Clock::now();
+    auto activeTime = _activeTime + (_inFlight > 0 ? now - _activeSince : Clock::duration::zero());
+    std::map<std::string, float> statistics;
+    for (std::size_t stageId = 0; stageId < _stages.size(); ++stageId) {
+        auto& stage = *_stages[stageId];
+        auto busyTime = stage._busyTime + (stage._running > 0 ? now - stage._busySince : Clock::duration::zero());
+        auto prefix = "STAGE_" + std::to_string(stageId) + "_";
+        statistics[prefix + "UTILIZATION"] = activeTime.count() > 0 ?
+            std::min(1.f, Milliseconds(busyTime).count() / Milliseconds(activeTime).count()) : 0.f;
+        statistics[prefix + "BUBBLES"] = static_cast<float>(stage._bubbles);
+        statistics[prefix + "BUBBLE_TIME_MS"] = Milliseconds(stage._bubbleTime).count();
+        statistics[prefix + "INFERENCES"] = static_cast<float>(stage._inferences);
+        statistics[prefix + "POOL_SIZE"] = static_cast<float>(stage._workers.size());
+    }
+    return statistics;
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for pipelined execution of HETERO subgraphs
+ * @file hetero_pipeline.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Runs subgraphs of all infer requests of an executable network on shared pools of device infer requests.
+ * Each subgraph is a stage with a bounded pool of requests and a FIFO queue of jobs waiting for an idle request,
+ * so a stage of one infer request overlaps the next stage of the previous one. The queue length is bounded
+ * by the number of infer requests, as each of them waits for at most one stage at a time.
+ */
+class HeteroPipeline {
+public:
+    using Ptr = std::shared_ptr<HeteroPipeline>;
+    /**
+     * @brief Sets blobs of the infer request before the stage starts it
+     */
+    using Prepare = std::function<void(const InferenceEngine::InferRequest::Ptr&)>;
+    /**
+     * @brief Reads results of the infer request after the stage completes and before the request
+     * returns to the pool, where another infer request may take it
+     */
+    using Complete = std::function<void(const InferenceEngine::InferRequest::Ptr&)>;
+    /**
+     * @brief Called on the stage completion with nullptr or an exception raised by the stage
+     */
+    using Done = std::function<void(std::exception_ptr)>;
+
+    struct StageDesc {
+        InferenceEngine::ExecutableNetwork  _network;
+        std::size_t                         _poolSize;
+    };
+
+    explicit HeteroPipeline(const std::vector<StageDesc>& stages);
+
+    /**
+     * @brief Marks the start of an infer request. Stage statistics are gathered while at least one request is started
+     */
+    void Begin();
+    /**
+     * @brief Marks the finish of an infer request started by Begin()
+     */
+    void End();
+
+    void StartAsync(std::size_t stageId, Prepare prepare, Complete complete, Done done);
+    void Infer(std::size_t stageId, Prepare prepare, Complete complete);
+
+    std::map<std::string, float> GetStatistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        Prepare     _prepare;
+        Complete    _complete;
+        Done        _done;
+    };
+
+    struct Worker {
+        InferenceEngine::InferRequest::Ptr  _request;
+        Job                                 _job;
+    };
+
+    struct Stage {
+        std::vector<std::unique_ptr<Worker>>    _workers;
+        std::queue<Worker*>                     _idleWorkers;
+        std::deque<Job>                         _jobs;
+        std::size_t                             _running = 0;
+        std::size_t                             _inferences = 0;
+        std::size_t                             _bubbles = 0;
+        bool                                    _inBubble = false;
+        Clock::time_point                       _busySince;
+        Clock::time_point                       _bubbleSince;
+        Clock::duration                         _busyTime = Clock::duration::zero();
+        Clock::duration                         _bubbleTime = Clock::duration::zero();
+    };
+
+    void Run(Stage& stage, Worker& worker);
+    void OnComplete(Stage& stage, Worker& worker, InferenceEngine::StatusCode status);
+    void Acquired(Stage& stage, Clock::time_point now);
+    bool Release(Stage& stage, Worker& worker);
+
+    mutable std::mutex                  _mutex;
+    std::vector<std::unique_ptr<Stage>> _stages;
+    std::size_t                         _inFlight = 0;
+    Clock::time_point                   _activeSince;
+    Clock::duration                     _activeTime = Clock::duration::zero();
+};
+
+}  // namespace HeteroPlugin
@@ -4,11 +4,20 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_memcpy.h"
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 
@@ -16,6 +25,96 @@
 
 namespace InferenceEngine {
 
+// Transposes rows x cols matrix: dst[c * dst_stride + r] = src[r * src_stride + c]
+template <typename T>
+static void blob_transpose(const T* src, size_t src_stride, T* dst, size_t dst_stride, size_t rows, size_t cols) {
+#ifdef HAVE_AVX512
+    if (sizeof(T) == 4 && with_cpu_x86_avx512f()) {
+        blob_transpose_32_avx512(reinterpret_cast<const uint32_t*>(src), src_stride,
+                                 reinterpret_cast<uint32_t*>(dst), dst_stride, rows, cols);
+        return;
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        switch (sizeof(T)) {
+        case 2:
+            blob_transpose_16_avx2(reinterpret_cast<const uint16_t*>(src), src_stride,
+                                   reinterpret_cast<uint16_t*>(dst), dst_stride, rows, cols);
+            return;
+        case 4:
+            blob_transpose_32_avx2(reinterpret_cast<const uint32_t*>(src), src_stride,
+                                   reinterpret_cast<uint32_t*>(dst), dst_stride, rows, cols);
+            return;
+        case 8:
+            blob_transpose_64_avx2(reinterpret_cast<const uint64_t*>(src), src_stride,
+                                   reinterpret_cast<uint64_t*>(dst), dst_stride, rows, cols);
+            return;
+        default:
+            break;
+        }
+    }
+#endif  // HAVE_AVX2
+
+    // blocks keep both source and destination lines in cache
+    constexpr size_t block = 16;
+    for (size_t r0 = 0; r0 < rows; r0 += block) {
+        const size_t r1 = std::min(rows, r0 + block);
+        for (size_t c0 = 0; c0 < cols; c0 += block) {
+            const size_t c1 = std::min(cols, c0 + block);
+            for (size_t r = r0; r < r1; r++)
+                for (size_t c = c0; c < c1; c++)
+                    dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+}
+
+// Copies (N, H) or (N, D, H) row of a blob between interleaved and planar layouts:
+// dst[c * dst_c_stride + r * dst_r_stride] = src[r * src_r_stride + c * src_c_stride]
+template <typename T>
+static inline void blob_copy_row_transpose(const T* src, size_t src_r_stride, size_t src_c_stride,
+                                           T* dst, size_t dst_c_stride, size_t dst_r_stride,
+                                           size_t rows, size_t cols) {
+    if (src_c_stride == 1 && dst_r_stride == 1) {
+        blob_transpose(src, src_r_stride, dst, dst_c_stride, rows, cols);
+        return;
+    }
+
+    for (size_t c = 0; c < cols; c++)
+        for (size_t r = 0; r < rows; r++)
+            dst[c * dst_c_stride + r * dst_r_stride] = src[r * src_r_stride + c * src_c_stride];
+}
+
+#ifdef HAVE_SSE
+// 3-channel rows are processed by SSE4.2 primitives, only U8 and FP32 ones are available
+template <typename T>
+static inline void blob_copy_row_split_c3(const T*, T*, size_t, size_t) {
+    THROW_IE_EXCEPTION << "Unsupported precision of 3-channel blob copy";
+}
+
+static inline void blob_copy_row_split_c3(const uint8_t* src, uint8_t* dst, size_t C_dst_stride, size_t W) {
+    blob_copy_4d_split_u8c3(src, dst, 0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+}
+
+static inline void blob_copy_row_split_c3(const float* src, float* dst, size_t C_dst_stride, size_t W) {
+    blob_copy_4d_split_f32c3(src, dst, 0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+}
+
+template <typename T>
+static inline void blob_copy_row_merge_c3(const T*, size_t, T*, size_t) {
+    THROW_IE_EXCEPTION << "Unsupported precision of 3-channel blob copy";
+}
+
+static inline void blob_copy_row_merge_c3(const uint8_t* src, size_t C_src_stride, uint8_t* dst, size_t W) {
+    blob_copy_4d_merge_u8c3(src, dst, 0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+}
+
+static inline void blob_copy_row_merge_c3(const float* src, size_t C_src_stride, float* dst, size_t W) {
+    blob_copy_4d_merge_f32c3(src, dst, 0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+}
+#endif  // HAVE_SSE
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -46,86 +145,54 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
-
+    if (src_l == NHWC && dst_l == NCHW) {
 #ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
+        const bool split_c3 = C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&
+                              (PRC == Precision::U8 || PRC == Precision::FP32) && with_cpu_x86_sse42();
 #endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            const data_t* src_row = src_ptr + n * N_src_stride + h * H_src_stride;
+            data_t* dst_row = dst_ptr + n * N_dst_stride + h * H_dst_stride;
+#ifdef HAVE_SSE
+            if (split_c3) {
+                blob_copy_row_split_c3(src_row, dst_row, C_dst_stride, W);
+                return;
             }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
+#endif  // HAVE_SSE
+            blob_copy_row_transpose(src_row, W_src_stride, C_src_stride, dst_row, C_dst_stride, W_dst_stride, W, C);
+        });
+    } else if (src_l == NCHW && dst_l == NHWC) {
+#ifdef HAVE_SSE
+        const bool merge_c3 = C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 &&
+                              (PRC == Precision::U8 || PRC == Precision::FP32) && with_cpu_x86_sse42();
+#endif  // HAVE_SSE
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            const data_t* src_row = src_ptr + n * N_src_stride + h * H_src_stride;
+            data_t* dst_row = dst_ptr + n * N_dst_stride + h * H_dst_stride;
+#ifdef HAVE_SSE
+            if (merge_c3) {
+                blob_copy_row_merge_c3(src_row, C_src_stride, dst_row, W);
+                return;
             }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+#endif  // HAVE_SSE
+            blob_copy_row_transpose(src_row, C_src_stride, W_src_stride, dst_row, W_dst_stride, C_dst_stride, C, W);
+        });
+    } else if (src_ptr != dst_ptr) {
+        const size_t size = N * C * H * W * sizeof(data_t);
+        ie_memcpy(dst_ptr, size, src_ptr, size);
     }
 }
 
 static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
+    case Precision::I64:
+    case Precision::U64:
+    case Precision::FP64:
+        blob_copy_4d_t<Precision::I64>(src, dst);
+        break;
+
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
@@ -133,6 +200,7 @@ static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
         break;
 
     case Precision::FP16:
+    case Precision::BF16:
     case Precision::U16:
     case Precision::I16:
         blob_copy_4d_t<Precision::U16>(src, dst);
@@ -140,6 +208,7 @@ static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
 
     case Precision::U8:
     case Precision::I8:
+    case Precision::BOOL:
         blob_copy_4d_t<Precision::U8>(src, dst);
         break;
 
@@ -182,90 +251,52 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
+    if (src_l == NDHWC && dst_l == NCDHW) {
 #ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
+        const bool split_c3 = C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&
+                              (PRC == Precision::U8 || PRC == Precision::FP32) && with_cpu_x86_sse42();
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            const data_t* src_row = src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride;
+            data_t* dst_row = dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride;
+#ifdef HAVE_SSE
+            if (split_c3) {
+                blob_copy_row_split_c3(src_row, dst_row, C_dst_stride, W);
+                return;
             }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
+#endif  // HAVE_SSE
+            blob_copy_row_transpose(src_row, W_src_stride, C_src_stride, dst_row, C_dst_stride, W_dst_stride, W, C);
+        });
+    } else if (src_l == NCDHW && dst_l == NDHWC) {
+#ifdef HAVE_SSE
+        const bool merge_c3 = C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 &&
+                              (PRC == Precision::U8 || PRC == Precision::FP32) && with_cpu_x86_sse42();
+#endif  // HAVE_SSE
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            const data_t* src_row = src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride;
+            data_t* dst_row = dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride;
+#ifdef HAVE_SSE
+            if (merge_c3) {
+                blob_copy_row_merge_c3(src_row, C_src_stride, dst_row, W);
+                return;
             }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+#endif  // HAVE_SSE
+            blob_copy_row_transpose(src_row, C_src_stride, W_src_stride, dst_row, W_dst_stride, C_dst_stride, C, W);
+        });
+    } else if (src_ptr != dst_ptr) {
+        const size_t size = N * C * D * H * W * sizeof(data_t);
+        ie_memcpy(dst_ptr, size, src_ptr, size);
     }
 }
 
 static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
+    case Precision::I64:
+    case Precision::U64:
+    case Precision::FP64:
+        blob_copy_5d_t<Precision::I64>(src, dst);
+        break;
+
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
@@ -273,6 +304,7 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
         break;
 
     case Precision::FP16:
+    case Precision::BF16:
     case Precision::U16:
     case Precision::I16:
         blob_copy_5d_t<Precision::U16>(src, dst);
@@ -280,6 +312,7 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
 
     case Precision::U8:
     case Precision::I8:
+    case Precision::BOOL:
         blob_copy_5d_t<Precision::U8>(src, dst);
         break;
 
@@ -0,0 +1,141 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+
+namespace {
+
+inline void transpose_8x8(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride) {
+    __m128i r[8];
+    for (int i = 0; i < 8; i++)
+        r[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * src_stride));
+
+    __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+    __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+    __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+    __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+    __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+    __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+    __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+    __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+    __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+    __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+    __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+    __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+    __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+    __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+    r[0] = _mm_unpacklo_epi64(b0, b4);
+    r[1] = _mm_unpackhi_epi64(b0, b4);
+    r[2] = _mm_unpacklo_epi64(b1, b5);
+    r[3] = _mm_unpackhi_epi64(b1, b5);
+    r[4] = _mm_unpacklo_epi64(b2, b6);
+    r[5] = _mm_unpackhi_epi64(b2, b6);
+    r[6] = _mm_unpacklo_epi64(b3, b7);
+    r[7] = _mm_unpackhi_epi64(b3, b7);
+
+    for (int i = 0; i < 8; i++)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * dst_stride), r[i]);
+}
+
+inline void transpose_8x8(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride) {
+    __m256 r[8];
+    for (int i = 0; i < 8; i++)
+        r[i] = _mm256_loadu_ps(reinterpret_cast<const float*>(src + i * src_stride));
+
+    __m256 a0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 a1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 a2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 a3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 a4 = _mm256_unpacklo_ps(r[4], r[5]);
+    __m256 a5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 a6 = _mm256_unpacklo_ps(r[6], r[7]);
+    __m256 a7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+    __m256 b0 = _mm256_shuffle_ps(a0, a2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 b1 = _mm256_shuffle_ps(a0, a2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 b2 = _mm256_shuffle_ps(a1, a3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 b3 = _mm256_shuffle_ps(a1, a3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 b4 = _mm256_shuffle_ps(a4, a6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 b5 = _mm256_shuffle_ps(a4, a6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 b6 = _mm256_shuffle_ps(a5, a7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 b7 = _mm256_shuffle_ps(a5, a7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    r[0] = _mm256_permute2f128_ps(b0, b4, 0x20);
+    r[1] = _mm256_permute2f128_ps(b1, b5, 0x20);
+    r[2] = _mm256_permute2f128_ps(b2, b6, 0x20);
+    r[3] = _mm256_permute2f128_ps(b3, b7, 0x20);
+    r[4] = _mm256_permute2f128_ps(b0, b4, 0x31);
+    r[5] = _mm256_permute2f128_ps(b1, b5, 0x31);
+    r[6] = _mm256_permute2f128_ps(b2, b6, 0x31);
+    r[7] = _mm256_permute2f128_ps(b3, b7, 0x31);
+
+    for (int i = 0; i < 8; i++)
+        _mm256_storeu_ps(reinterpret_cast<float*>(dst + i * dst_stride), r[i]);
+}
+
+inline void transpose_4x4(const uint64_t* src, size_t src_stride, uint64_t* dst, size_t dst_stride) {
+    __m256d r0 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 0 * src_stride));
+    __m256d r1 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 1 * src_stride));
+    __m256d r2 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 2 * src_stride));
+    __m256d r3 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 3 * src_stride));
+
+    __m256d a0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d a1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d a2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d a3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 0 * dst_stride), _mm256_permute2f128_pd(a0, a2, 0x20));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 1 * dst_stride), _mm256_permute2f128_pd(a1, a3, 0x20));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 2 * dst_stride), _mm256_permute2f128_pd(a0, a2, 0x31));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 3 * dst_stride), _mm256_permute2f128_pd(a1, a3, 0x31));
+}
+
+template <size_t BLOCK, typename T, typename F>
+inline void blob_transpose_blocked(const T* src, size_t src_stride, T* dst, size_t dst_stride,
+                                   size_t rows, size_t cols, F transpose_block) {
+    size_t r = 0;
+    for (; r + BLOCK <= rows; r += BLOCK) {
+        size_t c = 0;
+        for (; c + BLOCK <= cols; c += BLOCK)
+            transpose_block(src + r * src_stride + c, src_stride, dst + c * dst_stride + r, dst_stride);
+
+        for (; c < cols; c++)
+            for (size_t i = r; i < r + BLOCK; i++)
+                dst[c * dst_stride + i] = src[i * src_stride + c];
+    }
+
+    for (; r < rows; r++)
+        for (size_t c = 0; c < cols; c++)
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+}
+
+}  // namespace
+
+void blob_transpose_16_avx2(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols) {
+    blob_transpose_blocked<8>(src, src_stride, dst, dst_stride, rows, cols,
+        [](const uint16_t* s, size_t ss, uint16_t* d, size_t ds) { transpose_8x8(s, ss, d, ds); });
+}
+
+void blob_transpose_32_avx2(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols) {
+    blob_transpose_blocked<8>(src, src_stride, dst, dst_stride, rows, cols,
+        [](const uint32_t* s, size_t ss, uint32_t* d, size_t ds) { transpose_8x8(s, ss, d, ds); });
+}
+
+void blob_transpose_64_avx2(const uint64_t* src, size_t src_stride, uint64_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols) {
+    blob_transpose_blocked<4>(src, src_stride, dst, dst_stride, rows, cols,
+        [](const uint64_t* s, size_t ss, uint64_t* d, size_t ds) { transpose_4x4(s, ss, d, ds); });
+}
+
+}  // namespace InferenceEngine
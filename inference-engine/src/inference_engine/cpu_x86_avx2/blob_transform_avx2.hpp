@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o threads)
+//
+// Transpose rows x cols matrix: dst[c * dst_stride + r] = src[r * src_stride + c]
+// NHWC <-> NCHW conversion transposes W x C matrix of every (N, H) row
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_16_avx2(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols);
+
+void blob_transpose_32_avx2(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols);
+
+void blob_transpose_64_avx2(const uint64_t* src, size_t src_stride, uint64_t* dst, size_t dst_stride,
+                            size_t rows, size_t cols);
+
+}  // namespace InferenceEngine
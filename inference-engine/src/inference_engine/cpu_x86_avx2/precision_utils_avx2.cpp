@@ -0,0 +1,111 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+
+inline __m256 f16tof32(__m128i x) {
+    const __m256i h = _mm256_cvtepu16_epi32(x);
+    const __m256i s = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+    const __m256i u = _mm256_and_si256(h, _mm256_set1_epi32(0x7FFF));
+    const __m256i e = _mm256_and_si256(u, _mm256_set1_epi32(0x7C00));
+
+    // normal values: shift mantissa and exp to f32 position and change exp bias from 15 to 127
+    __m256i r = _mm256_add_epi32(_mm256_slli_epi32(u, 13), _mm256_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF: keep mantissa only, NAN gets the quiet bit
+    const __m256i m = _mm256_and_si256(u, _mm256_set1_epi32(0x03FF));
+    const __m256i is_nan_m = _mm256_andnot_si256(_mm256_cmpeq_epi32(m, _mm256_setzero_si256()),
+                                                 _mm256_set1_epi32(0x0200));
+    const __m256i nan_inf = _mm256_or_si256(_mm256_slli_epi32(_mm256_or_si256(m, is_nan_m), 13),
+                                            _mm256_set1_epi32(0x7F800000));
+    r = _mm256_blendv_epi8(r, nan_inf, _mm256_cmpeq_epi32(e, _mm256_set1_epi32(0x7C00)));
+
+    // zero and denormals: 2^-14 * (1 + m / 2^10) - 2^-14 is exact
+    const __m256 magic = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 denorm = _mm256_sub_ps(
+        _mm256_castsi256_ps(_mm256_add_epi32(_mm256_slli_epi32(u, 13), _mm256_castps_si256(magic))), magic);
+    r = _mm256_blendv_epi8(r, _mm256_castps_si256(denorm), _mm256_cmpeq_epi32(e, _mm256_setzero_si256()));
+
+    return _mm256_castsi256_ps(_mm256_or_si256(r, s));
+}
+
+inline __m128i f32tof16(__m256 x) {
+    // see scalar f32tof16 for the description of the constants
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 15) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m256i max16f16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+
+    const __m256i v = _mm256_castps_si256(x);
+    const __m256i s = _mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x8000));
+    const __m256i a = _mm256_and_si256(v, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i e = _mm256_and_si256(a, exp_mask);
+
+    // to make f32 round to nearest f16 add half ULP of f16 to the origin value
+    const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(e), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    const __m256 f = _mm256_add_ps(_mm256_castsi256_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16
+    __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(f), _mm256_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm256_blendv_epi8(r, max16f16, _mm256_castps_si256(_mm256_cmp_ps(f, max16, _CMP_GE_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(1 << 10), _mm256_castps_si256(_mm256_cmp_ps(f, min16, _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_setzero_si256(), _mm256_castps_si256(_mm256_cmp_ps(f, half_min16, _CMP_LT_OQ)));
+
+    // NAN and INF
+    const __m256i is_nan = _mm256_andnot_si256(
+        _mm256_cmpeq_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0x007FFFFF)), _mm256_setzero_si256()),
+        _mm256_set1_epi32(-1));
+    const __m256i nan_inf = _mm256_blendv_epi8(_mm256_set1_epi32(0x7C00),
+                                               _mm256_or_si256(_mm256_srli_epi32(a, 23 - 10), _mm256_set1_epi32(0x0200)),
+                                               is_nan);
+    r = _mm256_blendv_epi8(r, nan_inf, _mm256_cmpeq_epi32(e, exp_mask));
+
+    // f16 value is the lower half of the result as in the scalar code
+    r = _mm256_and_si256(_mm256_or_si256(r, s), _mm256_set1_epi32(0xFFFF));
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xD8);
+    return _mm256_castsi256_si128(r);
+}
+
+}  // namespace
+
+void f16tof32Arrays_avx2(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = f16tof32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(x, vscale), vbias));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx2(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), f32tof16(x));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
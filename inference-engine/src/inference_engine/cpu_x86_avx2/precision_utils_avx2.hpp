@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16 <-> FP32 array conversions manually vectored for AVX2 (w/o threads)
+//
+// Results are bit-exact with f16tof32 and f32tof16: the custom rounding and
+// saturation of f32tof16 are emulated with integer operations
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_avx2(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_avx2(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+
+namespace {
+
+inline __m512 unpacklo_pd(__m512 a, __m512 b) {
+    return _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(a), _mm512_castps_pd(b)));
+}
+
+inline __m512 unpackhi_pd(__m512 a, __m512 b) {
+    return _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(a), _mm512_castps_pd(b)));
+}
+
+inline void transpose_16x16(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride) {
+    __m512 r[16], t[16];
+    for (int i = 0; i < 16; i++)
+        r[i] = _mm512_loadu_ps(reinterpret_cast<const float*>(src + i * src_stride));
+
+    // interleave 32-bit elements of row pairs
+    for (int i = 0; i < 16; i += 2) {
+        t[i]     = _mm512_unpacklo_ps(r[i], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_ps(r[i], r[i + 1]);
+    }
+
+    // interleave 64-bit elements, every 128-bit lane holds a column of four rows
+    for (int i = 0; i < 16; i += 4) {
+        r[i]     = unpacklo_pd(t[i], t[i + 2]);
+        r[i + 1] = unpackhi_pd(t[i], t[i + 2]);
+        r[i + 2] = unpacklo_pd(t[i + 1], t[i + 3]);
+        r[i + 3] = unpackhi_pd(t[i + 1], t[i + 3]);
+    }
+
+    // gather 128-bit lanes of four rows groups
+    for (int i = 0; i < 4; i++) {
+        t[i]      = _mm512_shuffle_f32x4(r[i], r[i + 4], 0x88);
+        t[i + 4]  = _mm512_shuffle_f32x4(r[i], r[i + 4], 0xdd);
+        t[i + 8]  = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0x88);
+        t[i + 12] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], 0xdd);
+    }
+    for (int i = 0; i < 8; i++) {
+        r[i]     = _mm512_shuffle_f32x4(t[i], t[i + 8], 0x88);
+        r[i + 8] = _mm512_shuffle_f32x4(t[i], t[i + 8], 0xdd);
+    }
+
+    for (int i = 0; i < 16; i++)
+        _mm512_storeu_ps(reinterpret_cast<float*>(dst + i * dst_stride), r[i]);
+}
+
+}  // namespace
+
+void blob_transpose_32_avx512(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride,
+                              size_t rows, size_t cols) {
+    size_t r = 0;
+    for (; r + 16 <= rows; r += 16) {
+        size_t c = 0;
+        for (; c + 16 <= cols; c += 16)
+            transpose_16x16(src + r * src_stride + c, src_stride, dst + c * dst_stride + r, dst_stride);
+
+        for (; c < cols; c++)
+            for (size_t i = r; i < r + 16; i++)
+                dst[c * dst_stride + i] = src[i * src_stride + c];
+    }
+
+    for (; r < rows; r++)
+        for (size_t c = 0; c < cols; c++)
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX-512 (w/o threads)
+//
+// Transpose rows x cols matrix: dst[c * dst_stride + r] = src[r * src_stride + c]
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_32_avx512(const uint32_t* src, size_t src_stride, uint32_t* dst, size_t dst_stride,
+                              size_t rows, size_t cols);
+
+}  // namespace InferenceEngine
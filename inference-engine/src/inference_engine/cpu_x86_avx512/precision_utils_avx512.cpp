@@ -0,0 +1,81 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+
+inline __m256i f32tof16(__m512 x) {
+    // see scalar f32tof16 for the description of the constants
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 half_min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 15) << 23));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m512i max16f16 = _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m512i exp_mask = _mm512_set1_epi32(0x7F800000);
+
+    const __m512i v = _mm512_castps_si512(x);
+    const __m512i s = _mm512_and_si512(_mm512_srli_epi32(v, 16), _mm512_set1_epi32(0x8000));
+    const __m512i a = _mm512_and_si512(v, _mm512_set1_epi32(0x7FFFFFFF));
+    const __m512i e = _mm512_and_si512(a, exp_mask);
+
+    // to make f32 round to nearest f16 add half ULP of f16 to the origin value
+    const __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(e), _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23)));
+    const __m512 f = _mm512_add_ps(_mm512_castsi512_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16
+    __m512i r = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(f), _mm512_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, max16, _CMP_GE_OQ), r, max16f16);
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, min16, _CMP_LT_OQ), r, _mm512_set1_epi32(1 << 10));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, half_min16, _CMP_LT_OQ), r, _mm512_setzero_si512());
+
+    // NAN and INF
+    const __mmask16 is_nan = _mm512_test_epi32_mask(a, _mm512_set1_epi32(0x007FFFFF));
+    const __m512i nan_inf = _mm512_mask_blend_epi32(is_nan, _mm512_set1_epi32(0x7C00),
+                                                    _mm512_or_si512(_mm512_srli_epi32(a, 23 - 10), _mm512_set1_epi32(0x0200)));
+    r = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(e, exp_mask), r, nan_inf);
+
+    // f16 value is the lower half of the result as in the scalar code
+    return _mm512_cvtepi32_epi16(_mm512_or_si512(r, s));
+}
+
+}  // namespace
+
+void f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        // hardware conversion is exact and sets the quiet bit of NAN as the scalar code does
+        __m512 x = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(x, vscale), vbias));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(src + i), vscale), vbias);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), f32tof16(x));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -2,12 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <array>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
 #include <mutex>
+#include <algorithm>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
@@ -22,6 +25,7 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_network_cache.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -93,6 +97,29 @@ void allowNotImplemented(F && f) {
     } catch (const NotImplemented & ex) { }
 }
 
+bool DeviceSupportsMetric(const InferencePlugin& plugin, const std::string& metricName) {
+    std::vector<std::string> supportedMetrics;
+    try {
+        supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {}).as<std::vector<std::string>>();
+    } catch (...) {
+        return false;
+    }
+    return std::find(supportedMetrics.begin(), supportedMetrics.end(), metricName) != supportedMetrics.end();
+}
+
+bool DeviceSupportsConfigKey(const InferencePlugin& plugin, const std::string& key) {
+    if (!DeviceSupportsMetric(plugin, METRIC_KEY(SUPPORTED_CONFIG_KEYS))) {
+        return false;
+    }
+    auto supportedKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {}).as<std::vector<std::string>>();
+    return std::find(supportedKeys.begin(), supportedKeys.end(), key) != supportedKeys.end();
+}
+
+bool DeviceSupportsImportExport(const InferencePlugin& plugin) {
+    return DeviceSupportsMetric(plugin, METRIC_KEY(IMPORT_EXPORT_SUPPORT)) &&
+           plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string& deviceNameWithID) {
@@ -170,6 +197,156 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    struct NetworkCacheStats {
+        unsigned int hits = 0;
+        unsigned int misses = 0;
+    };
+
+    // network cache state is guarded by pluginsMutex, cache statistics and per-key locks - by cacheMutex
+    std::string cacheDir;
+    std::shared_ptr<details::NetworkCacheStorage> cacheStorage;
+    mutable std::mutex cacheMutex;
+    // striped locks of cache keys, a fixed number of them is enough to serialize loads of the same network
+    std::array<std::mutex, 32> cacheKeyMutexes;
+    std::map<std::string, NetworkCacheStats> cacheStats;
+
+    struct NetworkKey {
+        std::weak_ptr<const ngraph::Function> function;
+        std::string key;
+    };
+    // keys of network contents are computed once per ngraph::Function, they are guarded by cacheMutex
+    mutable std::map<const ngraph::Function*, NetworkKey> networkKeys;
+
+    std::shared_ptr<details::NetworkCacheStorage> GetCacheStorage() const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        return cacheStorage;
+    }
+
+    std::mutex& GetCacheKeyMutex(const std::string& hash) {
+        return cacheKeyMutexes[std::hash<std::string>()(hash) % cacheKeyMutexes.size()];
+    }
+
+    void SetNetworkKey(const CNNNetwork& network, const std::string& key) const {
+        auto function = network.getFunction();
+        if (!function || key.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (auto it = networkKeys.begin(); it != networkKeys.end();) {
+            it = it->second.function.expired() ? networkKeys.erase(it) : std::next(it);
+        }
+        networkKeys[function.get()] = NetworkKey{function, key};
+    }
+
+    /**
+     * @brief Returns the key of the network content, the key of the files set by ReadNetwork or the hash of
+     * the serialized network computed on the first call for the ngraph::Function
+     */
+    std::string GetNetworkKey(const CNNNetwork& network) const {
+        auto function = network.getFunction();
+        if (!function) {
+            return {};
+        }
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto it = networkKeys.find(function.get());
+            // the address can be reused by a new function after the old one is destroyed
+            if (it != networkKeys.end() && it->second.function.lock() == function) {
+                return it->second.key;
+            }
+        }
+        auto key = details::ComputeNetworkKey(network, GetExtensionsOpsets());
+        SetNetworkKey(network, key);
+        return key;
+    }
+
+    void UpdateCacheStats(const std::string& deviceName, bool hit) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& stats = cacheStats[deviceName];
+        hit ? ++stats.hits : ++stats.misses;
+    }
+
+    /**
+     * @brief Collects everything except the network itself which affects the compiled network
+     * @param plugin A plugin which compiles the network
+     * @param parsed A device name and configuration passed to LoadNetwork
+     * @return A map of compile options
+     */
+    std::map<std::string, std::string> GetCompileOptions(const InferencePlugin& plugin,
+                                                         const Parsed<std::string>& parsed) const {
+        std::map<std::string, std::string> compileOptions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(parsed._deviceName);
+            if (it != pluginRegistry.end()) {
+                compileOptions = it->second.defaultConfig;
+            }
+        }
+        for (auto&& item : parsed._config) {
+            compileOptions[item.first] = item.second;
+        }
+        compileOptions.erase(KEY_CACHE_DIR);
+
+        auto version = plugin.GetVersion();
+        compileOptions["@DEVICE"] = parsed._deviceName;
+        compileOptions["@PLUGIN_VERSION"] = std::string(version.buildNumber) + " " + version.description;
+        compileOptions["@IE_VERSION"] = GetInferenceEngineVersion()->buildNumber;
+        return compileOptions;
+    }
+
+    std::map<std::string, ngraph::OpSet> GetExtensionsOpsets() const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        std::map<std::string, ngraph::OpSet> opsets;
+        for (const auto& extension : extensions) {
+            auto extensionOpsets = extension->getOpSets();
+            opsets.insert(extensionOpsets.begin(), extensionOpsets.end());
+        }
+        return opsets;
+    }
+
+    /**
+     * @brief Loads a network to the plugin using the network cache: the compiled network is imported
+     * if it was exported before, otherwise the network is compiled and exported to the cache
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network,
+                                           const Parsed<std::string>& parsed,
+                                           const std::shared_ptr<details::NetworkCacheStorage>& storage) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache");
+
+        auto networkKey = GetNetworkKey(network);
+        if (networkKey.empty()) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+        auto hash = details::ComputeNetworkHash(network, networkKey, GetCompileOptions(plugin, parsed));
+
+        // the same network is compiled only once if it is loaded from several threads at the same time
+        std::lock_guard<std::mutex> keyLock(GetCacheKeyMutex(hash));
+
+        ExecutableNetwork execNetwork;
+        bool loadedFromCache = false;
+        try {
+            loadedFromCache = storage->ReadBlob(hash, [&](std::istream& stream) {
+                execNetwork = plugin.ImportNetwork(stream, parsed._config);
+            });
+        } catch (const std::exception&) {
+            // the blob is corrupted or was exported by an incompatible plugin, it is replaced below
+            storage->RemoveBlob(hash);
+        }
+        UpdateCacheStats(parsed._deviceName, loadedFromCache);
+
+        if (!loadedFromCache) {
+            execNetwork = plugin.LoadNetwork(network, parsed._config);
+            try {
+                storage->WriteBlob(hash, [&](std::ostream& stream) {
+                    execNetwork.Export(stream);
+                });
+            } catch (const std::exception&) {
+                // caching is optional, the network is already loaded
+            }
+        }
+        return execNetwork;
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -254,7 +431,10 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPED_TASK(itt::domains::IE);
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        auto network = details::ReadNetwork(modelPath, binPath, extensions);
+        // the network cache uses the key of the files instead of hashing the network content
+        SetNetworkKey(network, details::ComputeModelFilesKey(modelPath, binPath));
+        return network;
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
@@ -266,7 +446,12 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        auto storage = GetCacheStorage();
+        if (storage && DeviceSupportsImportExport(plugin)) {
+            return LoadNetworkWithCache(plugin, network, parsed, storage);
+        }
+        return plugin.LoadNetwork(network, parsed._config);
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -314,6 +499,14 @@ public:
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+        // network cache statistics are collected by Core for every device
+        if (name == METRIC_KEY(NETWORK_CACHE_HITS) || name == METRIC_KEY(NETWORK_CACHE_MISSES)) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto it = cacheStats.find(parsed._deviceName);
+            NetworkCacheStats stats = it != cacheStats.end() ? it->second : NetworkCacheStats{};
+            return name == METRIC_KEY(NETWORK_CACHE_HITS) ? stats.hits : stats.misses;
+        }
+
         // we need to return a copy of Parameter object which is created on Core side,
         // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
         // TODO: remove this WA after *-31417 is resolved
@@ -365,6 +558,14 @@ public:
                         plugin.SetConfig(desc.defaultConfig);
                     });
 
+                    // cache directory set for all devices is passed only to plugins which support it
+                    if (!cacheDir.empty() && desc.defaultConfig.count(KEY_CACHE_DIR) == 0 &&
+                        DeviceSupportsConfigKey(plugin, KEY_CACHE_DIR)) {
+                        allowNotImplemented([&]() {
+                            plugin.SetConfig({{KEY_CACHE_DIR, cacheDir}});
+                        });
+                    }
+
                     allowNotImplemented([&]() {
                         for (auto&& extensionLocation : desc.listOfExtentions) {
                             plugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
@@ -447,9 +648,31 @@ public:
      * @param deviceName A device name to set config to
      *        If empty, config is set for all the plugins / plugin's meta-data
      */
-    void SetConfigForPlugins(const std::map<std::string, std::string>& config, const std::string& deviceName) {
+    void SetConfigForPlugins(const std::map<std::string, std::string>& configMap, const std::string& deviceName) {
         std::lock_guard<std::mutex> lock(pluginsMutex);
 
+        auto config = configMap;
+        // cache directory for all devices is handled by Core: it enables the network cache and
+        // is passed only to plugins which support the key
+        auto cacheDirIt = config.find(KEY_CACHE_DIR);
+        if (deviceName.empty() && cacheDirIt != config.end()) {
+            cacheDir = cacheDirIt->second;
+            cacheStorage = cacheDir.empty() ? nullptr : std::make_shared<details::NetworkCacheStorage>(cacheDir);
+            config.erase(cacheDirIt);
+
+            for (auto& plugin : plugins) {
+                if (DeviceSupportsConfigKey(plugin.second, KEY_CACHE_DIR)) {
+                    allowNotImplemented([&]() {
+                        plugin.second.SetConfig({{KEY_CACHE_DIR, cacheDir}});
+                    });
+                }
+            }
+        }
+
+        if (config.empty()) {
+            return;
+        }
+
         // set config for plugins in registry
         bool configIsSet = false;
         for (auto& desc : pluginRegistry) {
@@ -7,8 +7,20 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+namespace {
+
+// A single core cannot saturate memory bandwidth, so large buffers are copied by several threads.
+// Smaller buffers are copied by the calling thread to avoid the threading overhead.
+constexpr size_t parallelCopyThreshold = 1 << 20;
+constexpr size_t parallelCopyChunk = 256 << 10;
+
+}  // namespace
+
 int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
-    size_t i;
     if (!src || count > destsz ||
         count > (dest > src ? ((uintptr_t)dest - (uintptr_t)src) : ((uintptr_t)src - (uintptr_t)dest))) {
         // zero out dest if error detected
@@ -16,6 +28,18 @@ int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
         return -1;
     }
 
-    for (i = 0; i < count; ++i) (reinterpret_cast<uint8_t*>(dest))[i] = (reinterpret_cast<const uint8_t*>(src))[i];
+    // memcpy of the C runtime is dispatched to the widest vector instructions available
+    if (count < parallelCopyThreshold) {
+        memcpy(dest, src, count);
+        return 0;
+    }
+
+    auto dst_ptr = reinterpret_cast<uint8_t*>(dest);
+    auto src_ptr = reinterpret_cast<const uint8_t*>(src);
+    const size_t chunks = (count + parallelCopyChunk - 1) / parallelCopyChunk;
+    InferenceEngine::parallel_for(chunks, [&](size_t chunk) {
+        const size_t offset = chunk * parallelCopyChunk;
+        memcpy(dst_ptr + offset, src_ptr + offset, std::min(parallelCopyChunk, count - offset));
+    });
     return 0;
 }
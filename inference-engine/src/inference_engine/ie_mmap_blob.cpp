@@ -0,0 +1,134 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_blob.hpp"
+
+#include <file_utils.h>
+
+#include <cstdint>
+#include <memory>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Owns a read-only file mapping with copy-on-write pages
+ */
+class MappedFile {
+public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    static std::shared_ptr<MappedFile> Map(const std::string& filePath) {
+        std::shared_ptr<MappedFile> file(new MappedFile());
+#ifdef _WIN32
+# ifdef ENABLE_UNICODE_PATH_SUPPORT
+        std::wstring path = FileUtils::multiByteCharToWString(filePath.c_str());
+        file->_file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+# else
+        file->_file = ::CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+# endif
+        if (file->_file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file->_file, &fileSize) || fileSize.QuadPart == 0)
+            return nullptr;
+        file->_size = static_cast<size_t>(fileSize.QuadPart);
+
+        file->_mapping = ::CreateFileMapping(file->_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (file->_mapping == nullptr)
+            return nullptr;
+
+        file->_data = ::MapViewOfFile(file->_mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (file->_data == nullptr)
+            return nullptr;
+#else
+        int fd = ::open(filePath.c_str(), O_RDONLY);
+        if (fd == -1)
+            return nullptr;
+
+        struct stat fileStat = {};
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+            ::close(fd);
+            return nullptr;
+        }
+        file->_size = static_cast<size_t>(fileStat.st_size);
+
+        void* data = ::mmap(nullptr, file->_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+        file->_data = data;
+#endif
+        return file;
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (_data != nullptr)
+            ::UnmapViewOfFile(_data);
+        if (_mapping != nullptr)
+            ::CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            ::CloseHandle(_file);
+#else
+        if (_data != nullptr)
+            ::munmap(_data, _size);
+#endif
+    }
+
+    uint8_t* data() const {
+        return static_cast<uint8_t*>(_data);
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+private:
+    MappedFile() = default;
+
+    void* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+#endif
+};
+
+}  // namespace
+
+WeightsFileBlob::WeightsFileBlob(const std::shared_ptr<void>& holder, uint8_t* data, size_t size) :
+    TBlob<uint8_t>(TensorDesc(Precision::U8, { size }, Layout::C), data, size),
+    _holder(holder) {}
+
+WeightsFileBlob::~WeightsFileBlob() = default;
+
+Blob::Ptr MapFileToBlob(const std::string& filePath) {
+    auto file = MappedFile::Map(filePath);
+    if (!file)
+        return nullptr;
+    return std::make_shared<WeightsFileBlob>(file, file->data(), file->size());
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief U8 blob with the content of a weights file, which owns its memory. Readers reference the memory
+ * of such blobs from the network instead of copying it, memory of other blobs may be released by the
+ * caller after the network is read.
+ */
+class INFERENCE_ENGINE_API_CLASS(WeightsFileBlob) : public TBlob<uint8_t> {
+public:
+    /**
+     * @brief Creates a blob over the memory owned by the holder
+     * @param holder An object which owns the memory
+     * @param data A pointer to the memory
+     * @param size A size of the memory in bytes
+     */
+    WeightsFileBlob(const std::shared_ptr<void>& holder, uint8_t* data, size_t size);
+
+    ~WeightsFileBlob() override;
+
+private:
+    std::shared_ptr<void> _holder;
+};
+
+/**
+ * @brief Maps a file to memory and wraps it to WeightsFileBlob. The mapping is private: pages are loaded on
+ * the first access and shared with other processes mapping the same file, while writes to the blob
+ * are copied-on-write and never reach the file.
+ * @note Pages which are not copied yet are read from the file, so the file must not be truncated or rewritten
+ * while the blob exists: on POSIX an access to the pages beyond the new end of the file raises SIGBUS
+ * (e.g. if a network read from the file is serialized to the same path). Windows does not allow to truncate
+ * the mapped file.
+ * @param filePath A path to the file
+ * @return A blob which owns the mapping, or nullptr if the file cannot be mapped (e.g. it is empty)
+ */
+Blob::Ptr MapFileToBlob(const std::string& filePath);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,285 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_cache.hpp"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <streambuf>
+
+#include <details/ie_exception.hpp>
+#include <ngraph/function.hpp>
+#include <transformations/serialize.hpp>
+
+#include "file_utils.h"
+#include "ie_itt.hpp"
+
+#ifdef _WIN32
+# include <direct.h>
+# define mkdir(dir, mode) _mkdir(dir)
+#endif  // _WIN32
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Stream buffer which computes FNV-1a like hash of the written data over 8-byte words instead of
+ * storing it, so large weights are neither copied nor hashed byte by byte while the network is serialized
+ */
+class HashStreamBuf : public std::streambuf {
+public:
+    std::uint64_t GetHash() const {
+        auto hash = _hash;
+        for (std::size_t i = 0; i < _tailSize; i++) {
+            hash = (hash ^ static_cast<unsigned char>(_tail[i])) * prime;
+        }
+        return hash ^ (hash >> 32);
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char byte = traits_type::to_char_type(c);
+            xsputn(&byte, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        auto size = static_cast<std::size_t>(n);
+        // complete the word left from the previous write
+        if (_tailSize != 0) {
+            auto count = std::min(size, sizeof(std::uint64_t) - _tailSize);
+            std::memcpy(_tail + _tailSize, s, count);
+            _tailSize += count;
+            s += count;
+            size -= count;
+            if (_tailSize < sizeof(std::uint64_t)) {
+                return n;
+            }
+            Update(_tail);
+            _tailSize = 0;
+        }
+        for (; size >= sizeof(std::uint64_t); s += sizeof(std::uint64_t), size -= sizeof(std::uint64_t)) {
+            Update(s);
+        }
+        std::memcpy(_tail, s, size);
+        _tailSize = size;
+        return n;
+    }
+
+private:
+    static constexpr std::uint64_t prime = 1099511628211ULL;
+
+    void Update(const char* data) {
+        std::uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        _hash = (_hash ^ word) * prime;
+        // multiplication carries bits only upwards, fold the high bits back
+        _hash ^= _hash >> 29;
+    }
+
+    std::uint64_t _hash = 14695981039346656037ULL;
+    char _tail[sizeof(std::uint64_t)] = {};
+    std::size_t _tailSize = 0;
+};
+
+std::string toHex(std::initializer_list<std::uint64_t> hashes) {
+    std::ostringstream hex;
+    hex << std::hex << std::setfill('0');
+    for (auto hash : hashes) {
+        hex << std::setw(16) << hash;
+    }
+    return hex.str();
+}
+
+void createDirectory(const std::string& path) {
+    auto err = mkdir(path.c_str(), 0755);
+    if (err != 0 && errno != EEXIST) {
+        THROW_IE_EXCEPTION << "Cannot create network cache directory " << path << " (errno=" << errno << ")";
+    }
+}
+
+}  // namespace
+
+std::string ComputeModelFilesKey(const std::string& modelPath, const std::string& binPath) {
+    // other formats (e.g. ONNX) can refer to external data files which are not known here
+    const std::string xmlExtension = ".xml";
+    if (modelPath.size() <= xmlExtension.size() ||
+        modelPath.compare(modelPath.size() - xmlExtension.size(), xmlExtension.size(), xmlExtension) != 0) {
+        return {};
+    }
+    // the weights file is found by the reader the same way
+    auto weightsPath = binPath;
+    if (weightsPath.empty()) {
+        weightsPath = modelPath.substr(0, modelPath.size() - xmlExtension.size()) + ".bin";
+        if (!FileUtils::fileExist(weightsPath)) {
+            weightsPath.clear();
+        }
+    }
+
+    HashStreamBuf filesHash;
+    std::ostream files(&filesHash);
+    for (const auto& path : {modelPath, weightsPath}) {
+        if (path.empty()) {
+            continue;
+        }
+        struct stat status = {};
+        if (stat(path.c_str(), &status) != 0) {
+            return {};
+        }
+#ifdef _WIN32
+        char absolutePath[_MAX_PATH];
+        if (_fullpath(absolutePath, path.c_str(), _MAX_PATH) == nullptr) {
+#else
+        char absolutePath[PATH_MAX];
+        if (realpath(path.c_str(), absolutePath) == nullptr) {
+#endif
+            return {};
+        }
+        files << absolutePath << ':' << status.st_size << ':' << status.st_mtime << ';';
+    }
+    return "file" + toHex({filesHash.GetHash()});
+}
+
+std::string ComputeNetworkKey(const CNNNetwork& network, const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "ComputeNetworkKey");
+
+    auto function = network.getFunction();
+    if (!function) {
+        return {};
+    }
+
+    HashStreamBuf xmlHash, binHash;
+    {
+        std::ostream xmlStream(&xmlHash), binStream(&binHash);
+        try {
+            ngraph::pass::Serialize serializer(xmlStream, binStream, ngraph::pass::Serialize::Version::IR_V10,
+                                               customOpsets);
+            serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(function));
+        } catch (const std::exception&) {
+            // e.g. dynamic shapes or operations which are not supported by the serializer
+            return {};
+        }
+    }
+    return "ir" + toHex({xmlHash.GetHash(), binHash.GetHash()});
+}
+
+std::string ComputeNetworkHash(const CNNNetwork& network, const std::string& networkKey,
+                               const std::map<std::string, std::string>& compileOptions) {
+    HashStreamBuf infoHash;
+    {
+        std::ostream info(&infoHash);
+        info << networkKey << ';';
+        for (const auto& option : compileOptions) {
+            info << option.first << '=' << option.second << ';';
+        }
+        // the network key is computed once, while inputs can be reshaped and configured between loads
+        for (const auto& input : network.getInputsInfo()) {
+            const auto& preProcess = input.second->getPreProcess();
+            info << "in:" << input.first << ':' << input.second->getPrecision().name() << ':'
+                 << input.second->getLayout() << ':' << preProcess.getResizeAlgorithm() << ':'
+                 << preProcess.getColorFormat() << ':' << preProcess.getMeanVariant() << ':'
+                 << preProcess.getFusedNormalization() << ':';
+            for (auto dim : input.second->getTensorDesc().getDims()) {
+                info << dim << ',';
+            }
+            info << ';';
+            for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+                const auto& channel = preProcess[c];
+                info << std::setprecision(std::numeric_limits<float>::max_digits10)
+                     << channel->stdScale << ',' << channel->meanValue << ';';
+                if (channel->meanData) {
+                    info.write(channel->meanData->cbuffer().as<const char*>(), channel->meanData->byteSize());
+                }
+            }
+        }
+        for (const auto& output : network.getOutputsInfo()) {
+            info << "out:" << output.first << ':' << output.second->getPrecision().name() << ':'
+                 << output.second->getLayout() << ':';
+            for (auto dim : output.second->getTensorDesc().getDims()) {
+                info << dim << ',';
+            }
+            info << ';';
+        }
+    }
+    return toHex({infoHash.GetHash()});
+}
+
+NetworkCacheStorage::NetworkCacheStorage(const std::string& cacheDir) : _cacheDir(cacheDir) {
+    createDirectory(_cacheDir);
+}
+
+std::string NetworkCacheStorage::GetBlobPath(const std::string& hash) const {
+    return FileUtils::makePath(_cacheDir, hash + ".blob");
+}
+
+void NetworkCacheStorage::WriteBlob(const std::string& hash, const StreamWriter& writer) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCacheStorage::WriteBlob");
+
+    auto blobPath = GetBlobPath(hash);
+
+    // unique name prevents collisions with other threads and processes writing the same blob
+    std::random_device device;
+    std::ostringstream tmpPath;
+    tmpPath << blobPath << '.' << std::hex << device() << device() << ".tmp";
+
+    {
+        std::ofstream stream(tmpPath.str(), std::ios::binary);
+        if (!stream.is_open()) {
+            THROW_IE_EXCEPTION << "Cannot create network cache file " << tmpPath.str();
+        }
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpPath.str().c_str());
+            throw;
+        }
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.str().c_str());
+            THROW_IE_EXCEPTION << "Cannot write network cache file " << tmpPath.str();
+        }
+    }
+
+    if (std::rename(tmpPath.str().c_str(), blobPath.c_str()) != 0) {
+        // on Windows rename fails if the blob was already written by someone else, it is equivalent
+        std::remove(tmpPath.str().c_str());
+    }
+}
+
+bool NetworkCacheStorage::ReadBlob(const std::string& hash, const StreamReader& reader) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCacheStorage::ReadBlob");
+
+    std::ifstream stream(GetBlobPath(hash), std::ios::binary);
+    if (!stream.is_open()) {
+        return false;
+    }
+    reader(stream);
+    return true;
+}
+
+void NetworkCacheStorage::RemoveBlob(const std::string& hash) const {
+    std::remove(GetBlobPath(hash).c_str());
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
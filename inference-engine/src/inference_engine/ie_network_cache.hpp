@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset.hpp>
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Computes a key of the IR read from files: absolute paths, sizes and modification times
+ * of the .xml and .bin files, so the network content is not hashed
+ * @param modelPath A path to the model file
+ * @param binPath A path to the weights file, if it is empty the .bin file next to the model is used
+ * @return A string key, or an empty string if the model is not an IR or the files cannot be found
+ */
+std::string ComputeModelFilesKey(const std::string& modelPath, const std::string& binPath);
+
+/**
+ * @brief Computes a key of the network content: a hash of its IR v10 serialization (topology and weights)
+ * @param network A network to be compiled
+ * @param customOpsets Opsets of the registered extensions required to serialize custom operations
+ * @return A string key, or an empty string if the network cannot be cached (e.g. it is not
+ *         represented by ngraph::Function or cannot be serialized)
+ */
+std::string ComputeNetworkKey(const CNNNetwork& network, const std::map<std::string, ngraph::OpSet>& customOpsets);
+
+/**
+ * @brief Computes a key of the compiled network in the network cache
+ * @param network A network to be compiled
+ * @param networkKey A key of the network returned by ComputeModelFilesKey() or ComputeNetworkKey()
+ * @param compileOptions Device name, plugin version and configuration which affect the compilation
+ * @return A hexadecimal string which also covers input shapes, precisions, layouts and preprocessing
+ */
+std::string ComputeNetworkHash(const CNNNetwork& network, const std::string& networkKey,
+                               const std::map<std::string, std::string>& compileOptions);
+
+/**
+ * @brief File storage of exported networks, one `<hash>.blob` file per compiled network.
+ *
+ * Several processes can share the same directory: blobs are written to a unique temporary file
+ * which is atomically renamed, so readers observe either a complete blob or no blob at all.
+ */
+class NetworkCacheStorage {
+public:
+    using StreamWriter = std::function<void(std::ostream&)>;
+    using StreamReader = std::function<void(std::istream&)>;
+
+    /**
+     * @brief Creates a storage in the specified directory, the directory is created if it does not exist
+     * @param cacheDir A path to the cache directory
+     */
+    explicit NetworkCacheStorage(const std::string& cacheDir);
+
+    /**
+     * @brief Writes a blob for the given key, the existing blob is replaced
+     * @param hash A key of the blob
+     * @param writer A function which writes the blob content
+     */
+    void WriteBlob(const std::string& hash, const StreamWriter& writer) const;
+
+    /**
+     * @brief Reads a blob for the given key
+     * @param hash A key of the blob
+     * @param reader A function which reads the blob content, it is not called if there is no blob
+     * @return `true` if the blob exists and was passed to the reader
+     */
+    bool ReadBlob(const std::string& hash, const StreamReader& reader) const;
+
+    /**
+     * @brief Removes a blob for the given key, e.g. when it was produced by an incompatible plugin version
+     * @param hash A key of the blob
+     */
+    void RemoveBlob(const std::string& hash) const;
+
+    const std::string& GetCacheDir() const {
+        return _cacheDir;
+    }
+
+private:
+    std::string GetBlobPath(const std::string& hash) const;
+
+    std::string _cacheDir;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_blob.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -205,21 +206,29 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
+                // Weights are mapped to memory, so constants reference file pages instead of heap copies
+                Blob::Ptr weights = MapFileToBlob(bPath);
+                if (!weights) {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
 
-                binStream.read(weights->buffer(), fileSize);
+                    binStream.read(weights->buffer(), fileSize);
 
-                binStream.close();
+                    binStream.close();
+
+                    // the buffer is owned by the reader, so constants can reference it as the mapped file
+                    if (fileSize > 0)
+                        weights = std::make_shared<WeightsFileBlob>(weights, weights->buffer().as<uint8_t*>(), fileSize);
+                }
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
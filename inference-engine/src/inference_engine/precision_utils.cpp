@@ -4,26 +4,97 @@
 
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
 
 #include <stdint.h>
+#include <algorithm>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
+
+// Large arrays, e.g. FP16 network inputs and outputs, are converted by several threads
+constexpr size_t parallelConvertThreshold = 1 << 16;
+constexpr size_t parallelConvertChunk = 1 << 14;
+
+template <typename F>
+void convertArrays(size_t nelem, const F& convert) {
+    if (nelem < parallelConvertThreshold) {
+        convert(0, nelem);
+        return;
+    }
+
+    const size_t chunks = (nelem + parallelConvertChunk - 1) / parallelConvertChunk;
+    parallel_for(chunks, [&](size_t chunk) {
+        const size_t offset = chunk * parallelConvertChunk;
+        convert(offset, std::min(parallelConvertChunk, nelem - offset));
+    });
+}
+
+void f16tof32ArraysImpl(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        f16tof32Arrays_avx512(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        f16tof32Arrays_avx2(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif  // HAVE_AVX2
 
     for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
     }
 }
 
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+void f32tof16ArraysImpl(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        f32tof16Arrays_avx512(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        f32tof16Arrays_avx2(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif  // HAVE_AVX2
+
     for (size_t i = 0; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
 
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+
+    convertArrays(nelem, [&](size_t offset, size_t count) {
+        f16tof32ArraysImpl(dst + offset, _src + offset, count, scale, bias);
+    });
+}
+
+void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    convertArrays(nelem, [&](size_t offset, size_t count) {
+        f32tof16ArraysImpl(dst + offset, src + offset, count, scale, bias);
+    });
+}
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -9,6 +9,8 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <cstdint>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -146,6 +148,116 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov's algorithm).
+     *        Tasks which do not fit into the ring buffer are kept in the overflow queue protected by a mutex,
+     *        while the overflow queue is not empty new tasks are pushed to it too to keep tasks order.
+     */
+    struct TaskQueue {
+        static constexpr std::size_t ringSize = 256;
+        static_assert((ringSize & (ringSize - 1)) == 0, "Ring size should be a power of two");
+
+        struct Cell {
+            std::atomic<std::size_t>    _sequence;
+            Task                        _task;
+        };
+
+        TaskQueue() {
+            for (std::size_t i = 0; i < ringSize; ++i) {
+                _ring[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        void Push(Task task) {
+            if (0 == _overflowSize.load(std::memory_order_acquire) && PushToRing(task)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock{_overflowMutex};
+            _overflow.emplace_back(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+
+        bool Pop(Task& task) {
+            if (PopFromRing(task)) {
+                return true;
+            }
+            if (0 == _overflowSize.load(std::memory_order_acquire)) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock{_overflowMutex};
+            if (_overflow.empty()) {
+                return false;
+            }
+            task = std::move(_overflow.front());
+            _overflow.pop_front();
+            _overflowSize.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        bool PushToRing(Task& task) {
+            auto pos = _enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;) {
+                cell = &_ring[pos & (ringSize - 1)];
+                auto seq = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (0 == diff) {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool PopFromRing(Task& task) {
+            auto pos = _dequeuePos.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;) {
+                cell = &_ring[pos & (ringSize - 1)];
+                auto seq = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                if (0 == diff) {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            // moved-from std::function is not guaranteed to be empty, release captured objects explicitly
+            cell->_task = nullptr;
+            cell->_sequence.store(pos + ringSize, std::memory_order_release);
+            return true;
+        }
+
+        Cell                        _ring[ringSize];
+        std::atomic<std::size_t>    _enqueuePos = {0};
+        std::atomic<std::size_t>    _dequeuePos = {0};
+        std::mutex                  _overflowMutex;
+        std::deque<Task>            _overflow;
+        std::atomic<std::size_t>    _overflowSize = {0};
+    };
+
+    static constexpr std::size_t numberOfPriorities = 3;
+
+    /**
+     * @brief Per-stream queues, one queue for each task priority
+     */
+    struct StreamQueues {
+        TaskQueue _queues[numberOfPriorities];
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -159,33 +271,62 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _streamQueues.emplace_back(new StreamQueues);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_sleepMutex);
+                    if (_pendingTasks.load() > 0) {
+                        // a task is being pushed to a ring cell which is not published yet,
+                        // give the producer a chance to complete instead of spinning on the mutex
+                        lock.unlock();
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    if (_isStopped) {
+                        break;
                     }
+                    ++_sleepers;
+                    _queueCondVar.wait(lock, [&] { return _pendingTasks.load() > 0 || _isStopped; });
+                    --_sleepers;
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    void Enqueue(Task task, TaskPriority priority) {
+        auto queueId = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _streamQueues.size();
+        _streamQueues[queueId]->_queues[static_cast<std::size_t>(priority)].Push(std::move(task));
+        // sequentially consistent increment and load pairs with the sleeping worker, so the wake up is not lost
+        _pendingTasks.fetch_add(1);
+        if (_sleepers.load() > 0) {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool Pop(int streamId, Task& task) {
+        const auto numberOfQueues = _streamQueues.size();
+        for (std::size_t priority = 0; priority < numberOfPriorities; ++priority) {
+            // own queue first then try to steal a task of the same priority from other streams
+            for (std::size_t i = 0; i < numberOfQueues; ++i) {
+                auto& queue = _streamQueues[(streamId + i) % numberOfQueues]->_queues[priority];
+                if (queue.Pop(task)) {
+                    // the counter is decremented with the pop, so other streams do not see the taken task as pending
+                    _pendingTasks.fetch_sub(1);
+                    return true;
+                }
+            }
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -221,9 +362,12 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
-    std::mutex                              _mutex;
+    std::vector<std::unique_ptr<StreamQueues>> _streamQueues;
+    std::atomic<std::size_t>                _nextQueue = {0};
+    std::atomic<std::int64_t>               _pendingTasks = {0};
+    std::atomic<int>                        _sleepers = {0};
+    std::mutex                              _sleepMutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -246,7 +390,7 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
     {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
+        std::lock_guard<std::mutex> lock(_impl->_sleepMutex);
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
@@ -262,10 +406,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), TaskPriority::NORMAL);
+}
+
+void CPUStreamsExecutor::run(Task task, TaskPriority priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
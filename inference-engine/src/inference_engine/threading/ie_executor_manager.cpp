@@ -22,6 +22,17 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+bool isSameConfig(const IStreamsExecutor::Config& executorConfig, const IStreamsExecutor::Config& config) {
+    return executorConfig._name == config._name &&
+           executorConfig._streams == config._streams &&
+           executorConfig._threadsPerStream == config._threadsPerStream &&
+           executorConfig._threadBindingType == config._threadBindingType &&
+           executorConfig._threadBindingStep == config._threadBindingStep &&
+           executorConfig._threadBindingOffset == config._threadBindingOffset;
+}
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -29,13 +40,7 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+        if (isSameConfig(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +48,17 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : cpuStreamsExecutors) {
+        if (isSameConfig(it.first, config))
+            return it.second;
+    }
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    cpuStreamsExecutors.emplace_back(std::make_pair(config, newExec));
+    return newExec;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -131,4 +147,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
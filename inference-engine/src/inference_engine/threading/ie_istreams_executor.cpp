@@ -13,11 +13,16 @@
 #include <algorithm>
 #include <vector>
 #include <thread>
+#include <utility>
 
 
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run(Task task, TaskPriority) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
@@ -79,6 +79,62 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INFER_PRIORITY) {
+            if (val == PluginConfigParams::CPU_PRIORITY_HIGH) inferPriority = IStreamsExecutor::TaskPriority::HIGH;
+            else if (val == PluginConfigParams::CPU_PRIORITY_NORMAL) inferPriority = IStreamsExecutor::TaskPriority::NORMAL;
+            else if (val == PluginConfigParams::CPU_PRIORITY_LOW) inferPriority = IStreamsExecutor::TaskPriority::LOW;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INFER_PRIORITY
+                                   << ". Expected only CPU_PRIORITY_HIGH/CPU_PRIORITY_NORMAL/CPU_PRIORITY_LOW";
+            shareStreams = true;
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES) {
+            if (val == PluginConfigParams::YES) dynamicShapes = true;
+            else if (val == PluginConfigParams::NO) dynamicShapes = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only positive integer numbers";
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only positive integer numbers";
+            dynamicShapesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY
+                                   << ". Expected only non-negative integer numbers";
+            perfCountHistory = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_TRACE) {
+            // empty string means that the trace is switched off
+            perfCountTrace = val;
+        } else if (key == PluginConfigParams::KEY_CPU_EXPORTABLE) {
+            if (val == PluginConfigParams::YES) exportable = true;
+            else if (val == PluginConfigParams::NO) exportable = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_EXPORTABLE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
+            // networks are exported to the cache by InferenceEngine::Core, empty string means that it is disabled
+            cacheDir = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -141,6 +197,36 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (interOpParallel == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::NO });
+
+        if (dynamicShapes == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(dynamicShapesCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY, std::to_string(perfCountHistory) });
+        _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_TRACE, perfCountTrace });
+        if (exportable)
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORTABLE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORTABLE, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
+
+        switch (inferPriority) {
+            case IStreamsExecutor::TaskPriority::HIGH:
+                _config.insert({ PluginConfigParams::KEY_CPU_INFER_PRIORITY, PluginConfigParams::CPU_PRIORITY_HIGH });
+            break;
+            case IStreamsExecutor::TaskPriority::NORMAL:
+                _config.insert({ PluginConfigParams::KEY_CPU_INFER_PRIORITY, PluginConfigParams::CPU_PRIORITY_NORMAL });
+            break;
+            case IStreamsExecutor::TaskPriority::LOW:
+                _config.insert({ PluginConfigParams::KEY_CPU_INFER_PRIORITY, PluginConfigParams::CPU_PRIORITY_LOW });
+            break;
+        }
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
@@ -21,10 +21,20 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallel = false;
+    bool dynamicShapes = false;
+    int dynamicShapesCacheSize = 8;
+    int perfCountHistory = 0;
+    std::string perfCountTrace = "";
+    bool exportable = false;
+    std::string cacheDir = "";
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    InferenceEngine::IStreamsExecutor::TaskPriority inferPriority = InferenceEngine::IStreamsExecutor::TaskPriority::NORMAL;
+    // networks with the priority set explicitly share streams, so their requests are ordered by the priority
+    bool shareStreams = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
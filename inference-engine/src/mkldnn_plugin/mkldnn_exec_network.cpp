@@ -11,6 +11,8 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
+#include "mkldnn_graph_dumper.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include "bf16transformer.h"
 #include <legacy/ie_util_internal.hpp>
@@ -24,12 +26,88 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <fstream>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <legacy/ie_layers_internal.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+/**
+ * @brief Submits tasks to the shared streams executor with the priority of the network,
+ *        so requests of latency critical networks overtake pending requests of bulk networks
+ */
+class PriorityTaskExecutor : public ITaskExecutor {
+public:
+    PriorityTaskExecutor(const IStreamsExecutor::Ptr& executor, IStreamsExecutor::TaskPriority priority) :
+        _executor{executor}, _priority{priority} {}
+
+    void run(Task task) override {
+        _executor->run(std::move(task), _priority);
+    }
+
+private:
+    IStreamsExecutor::Ptr           _executor;
+    IStreamsExecutor::TaskPriority  _priority;
+};
+
+// Pooling over the whole spatial dimensions without paddings (e.g. made of ReduceMean), the kernel of such pooling
+// is set to the new spatial dimensions when the network is reshaped
+bool isGlobalPooling(const CNNLayerPtr &layer) {
+    auto pooling = std::dynamic_pointer_cast<PoolingLayer>(layer);
+    if (!pooling || pooling->insData.empty() || !pooling->insData[0].lock())
+        return false;
+    const auto &dims = pooling->insData[0].lock()->getDims();
+    if (dims.size() < 3 || pooling->_kernel.size() != dims.size() - 2)
+        return false;
+    auto pads = getPaddings(*pooling);
+    for (size_t i = 0; i < pooling->_kernel.size(); i++) {
+        // properties are stored starting from the last axis
+        if (pooling->_kernel[i] != dims[dims.size() - 1 - i])
+            return false;
+        if ((i < pads.begin.size() && pads.begin[i] != 0) || (i < pads.end.size() && pads.end[i] != 0))
+            return false;
+    }
+    return true;
+}
+
+// Nodes of these layers take all the parameters which depend on dimensions from the dimensions of their inputs
+// and outputs, so they are initialized for other dimensions without reshaping the original network
+bool isShapeAgnostic(const CNNLayerPtr &layer) {
+    switch (TypeFromName(layer->type)) {
+        case MKLDNNPlugin::Pooling:
+            return isGlobalPooling(layer);
+        case MKLDNNPlugin::Input:
+        case MKLDNNPlugin::Convolution:
+        case MKLDNNPlugin::Eltwise:
+        case MKLDNNPlugin::Lrn:
+        case MKLDNNPlugin::SoftMax:
+        case MKLDNNPlugin::Concatenation:
+        case MKLDNNPlugin::Permute:
+        case MKLDNNPlugin::BatchNormalization:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns false if some data produced by non constant layers has no inferred dimensions of the same rank
+bool hasInferredDims(const CNNNetwork &network, const std::map<std::string, SizeVector> &dims) {
+    for (CNNNetworkIterator layer(network); layer != CNNNetworkIterator(); layer++) {
+        if ((*layer)->type == "Const")
+            continue;
+        for (const auto &data : (*layer)->outData) {
+            auto found = dims.find(data->getName());
+            if (found == dims.end() || found->second.size() != data->getDims().size())
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -42,6 +120,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      NumaNodesWeights &numaNodesWeights) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _numaNodesWeights{numaNodesWeights},
     _cfg{cfg},
     _name{network.getName()} {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
@@ -49,6 +128,111 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNetwork(network);
 
+    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
+    PrepareNetwork(_clonedNetwork);
+
+    OV_ITT_TASK_SKIP(taskChain);
+
+    if (_cfg.batchLimit > 1) {
+        // check topology for applicability
+        if (!CanProcessDynBatch(_clonedNetwork)) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        }
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        if (_cfg.shareStreams) {
+            // networks with the priority set share the executor, otherwise the priority lanes never compete
+            streamsExecutorConfig._name = "CPUSharedStreamsExecutor";
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
+        } else {
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+
+    // The first graph created on a NUMA node is compiled completely, graphs of other streams on the node
+    // are created from it: selected primitive descriptors are reused and constant data is shared
+    struct GraphTemplates {
+        std::mutex                      mutex;
+        std::map<int, MKLDNNGraph::Ptr> graphs;
+    };
+    auto templates = std::make_shared<GraphTemplates>();
+    // _taskExecutor can be wrapped later, so the streams executor is captured
+    _streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    auto* streamExecutor = _streamsExecutor;
+
+    _graphs = decltype(_graphs) {[&, templates, streamExecutor] {
+        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+        //       is fixed and does not change content of network passed (CVS-26420)
+        auto localNetwork = cloneNetwork(_clonedNetwork);
+
+        auto graph = std::make_shared<MKLDNNGraph>();
+        {
+            std::unique_lock<std::mutex> lock{_cfgMutex};
+            graph->setConfig(_cfg);
+        }
+        int numaNode = 0;
+        if (nullptr != streamExecutor) {
+            numaNode = streamExecutor->GetNumaNodeId();
+        }
+
+        MKLDNNGraph::Ptr templateGraph;
+        {
+            std::unique_lock<std::mutex> lock{templates->mutex};
+            auto& numaNodeTemplate = templates->graphs[numaNode];
+            if (nullptr == numaNodeTemplate) {
+                graph->CreateGraph(localNetwork, extensionManager, numaNodesWeights[numaNode]);
+                numaNodeTemplate = graph;
+                return graph;
+            }
+            templateGraph = numaNodeTemplate;
+        }
+
+        graph->CreateGraph(localNetwork, extensionManager, numaNodesWeights[numaNode], templateGraph);
+        return graph;
+    }};
+
+    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+
+    if (_cfg.shareStreams) {
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor);
+        if (nullptr != streamsExecutor) {
+            _taskExecutor = std::make_shared<PriorityTaskExecutor>(streamsExecutor, _cfg.inferPriority);
+        }
+    }
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    // States are bound to the infer requests, so they do not depend on the number of stream graphs.
+    for (auto &node : _graphs.begin()->get()->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
+
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+        }
+    }
+}
+
+void MKLDNNExecNetwork::PrepareNetwork(InferenceEngine::CNNNetwork &network) const {
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
@@ -68,15 +252,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Otherwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
-                bf16Transformer.convertToBFloat16(_clonedNetwork);
+            if (_cfg.enforceBF16 == true)
+                bf16Transformer.convertToBFloat16(network);
         } else {
             BF16Transformer bf16Transformer;
-            bf16Transformer.convertToFloat(_clonedNetwork);
+            bf16Transformer.convertToFloat(network);
         }
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, const std::vector<size_t>& shape, const std::string& name) {
         LayerParams attrs = {layer->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
         auto constLayer = std::make_shared<InferenceEngine::CNNLayer>(attrs);
@@ -90,7 +273,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         getInputTo(newEdgeAfterLayer).clear();
 
         IE_SUPPRESS_DEPRECATED_START
-        auto icnnnet = static_cast<ICNNNetwork::Ptr>(_clonedNetwork);
+        auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
         IE_SUPPRESS_DEPRECATED_END
         auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
         IE_ASSERT(implNetwork != nullptr);
@@ -104,7 +287,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     // The code block below transforms legacy layers to the form more compatible with opset1 in order to simplify future migration
     // TODO: remove after plug-in is migrated on opset1
-    auto all_layers = details::CNNNetSortTopologically(_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             auto constDimsRank = layer->insData[0].lock()->getDims().size();
@@ -193,71 +376,128 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+}
 
-    OV_ITT_TASK_SKIP(taskChain);
+void MKLDNNExecNetwork::setDynamicShapesBuilder(DynamicShapesBuilder builder) {
+    _dynamicShapesBuilder = std::move(builder);
+}
 
-    if (_cfg.batchLimit > 1) {
-        // check topology for applicability
-        if (!CanProcessDynBatch(_clonedNetwork)) {
-            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+void MKLDNNExecNetwork::setDynamicShapesInference(DynamicShapesInference inference) {
+    _dynamicShapesInference = std::move(inference);
+}
+
+bool MKLDNNExecNetwork::ReshapeCompiledNetwork(const ICNNNetwork::InputShapes &shapes, CNNNetwork &network) {
+    if (_shapesReinitialization == ShapesReinitialization::Unknown) {
+        // Data of the compiled network is matched with data of the original network by name, the match is checked
+        // for the network dimensions, as the transformations may replace layers keeping their names
+        bool supported = static_cast<bool>(_dynamicShapesInference);
+        for (CNNNetworkIterator layer(_clonedNetwork); supported && layer != CNNNetworkIterator(); layer++)
+            supported = isShapeAgnostic(*layer);
+        if (supported) {
+            try {
+                auto dims = _dynamicShapesInference(_clonedNetwork.getInputShapes());
+                supported = hasInferredDims(_clonedNetwork, dims);
+                for (CNNNetworkIterator layer(_clonedNetwork); supported && layer != CNNNetworkIterator(); layer++) {
+                    if ((*layer)->type == "Const")
+                        continue;
+                    for (const auto &data : (*layer)->outData)
+                        supported &= dims[data->getName()] == data->getDims();
+                }
+            } catch (const std::exception &) {
+                supported = false;
+            }
         }
+        _shapesReinitialization = supported ? ShapesReinitialization::Supported : ShapesReinitialization::Unsupported;
     }
+    if (_shapesReinitialization != ShapesReinitialization::Supported)
+        return false;
 
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-    }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
+    std::map<std::string, SizeVector> dims;
+    try {
+        dims = _dynamicShapesInference(shapes);
+    } catch (const std::exception &) {
+        // the original network is reshaped and compiled, so the error is reported by the reshape
+        return false;
     }
+    if (!hasInferredDims(_clonedNetwork, dims))
+        return false;
 
-    _graphs = decltype(_graphs) {[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNetwork(_clonedNetwork);
-
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
+    network = cloneNetwork(_clonedNetwork);
+    for (CNNNetworkIterator layer(network); layer != CNNNetworkIterator(); layer++) {
+        if ((*layer)->type == "Const")
+            continue;
+        for (const auto &data : (*layer)->outData)
+            data->reshape(dims[data->getName()], data->getLayout());
+    }
+    // only global pooling is accepted
+    for (CNNNetworkIterator layer(network); layer != CNNNetworkIterator(); layer++) {
+        if (auto pooling = std::dynamic_pointer_cast<PoolingLayer>(*layer)) {
+            const auto &inputDims = pooling->insData[0].lock()->getDims();
+            for (size_t i = 0; i < pooling->_kernel.size(); i++)
+                pooling->_kernel[i] = static_cast<unsigned int>(inputDims[inputDims.size() - 1 - i]);
         }
+    }
+    return true;
+}
 
-        graph->CreateGraph(localNetwork, extensionManager, numaNodesWeights[numaNode]);
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const BlobMap &inputs) {
+    auto graph = _graphs.local();
+    if (!_dynamicShapesBuilder)
         return graph;
-    }};
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    ICNNNetwork::InputShapes shapes;
+    bool networkShapes = true;
+    const auto &inputNodes = graph->GetInputNodes();
+    for (const auto &input : inputs) {
+        auto inputNode = inputNodes.find(input.first);
+        if (inputNode == inputNodes.end())
+            continue;
+        const auto &dims = input.second->getTensorDesc().getDims();
+        networkShapes &= dims == inputNode->second->getChildEdgeAt(0)->getDims().ToSizeVector();
+        shapes[input.first] = dims;
+    }
+    if (networkShapes)
+        return graph;
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+    auto &cache = _dynamicGraphs.local();
+    if (!cache)
+        cache = std::make_shared<MKLDNNGraphCache>(_cfg.dynamicShapesCacheSize);
+
+    return cache->findOrCreate(shapes, [&] {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::CreateDynamicShapesGraph");
+        // The compiled network is reinitialized for the new dimensions if all its layers support it: the graph takes
+        // primitive descriptors and constants from the graph of the stream, transformations are not repeated.
+        // Otherwise the original network is reshaped and compiled again.
+        CNNNetwork network;
+        bool reshaped = false;
+        {
+            // the original network is shared by all streams
+            std::lock_guard<std::mutex> lock{_dynamicShapesMutex};
+            reshaped = ReshapeCompiledNetwork(shapes, network);
+            if (!reshaped)
+                network = _dynamicShapesBuilder(shapes);
         }
+        if (!reshaped)
+            PrepareNetwork(network);
+
+        auto dynamicGraph = std::make_shared<MKLDNNGraph>();
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            dynamicGraph->setConfig(_cfg);
+        }
+        int numaNode = nullptr != _streamsExecutor ? _streamsExecutor->GetNumaNodeId() : 0;
+        // weights of the graph are shared with other graphs through the weights cache
+        dynamicGraph->CreateGraph(network, extensionManager, _numaNodesWeights[numaNode], reshaped ? graph : nullptr);
+        return dynamicGraph;
+    });
+}
+
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    // the trace set on loading is written once, when all requests of the network are completed
+    if (!_cfg.perfCountTrace.empty()) {
+        try {
+            dumpPerfTrace(_cfg.perfCountTrace);
+        } catch (...) {}
     }
 }
 
@@ -271,6 +511,46 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    for (auto &&entry : config) {
+        if (entry.first != PluginConfigParams::KEY_CPU_PERF_COUNT_TRACE)
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Unsupported ExecutableNetwork config key: " << entry.first;
+        dumpPerfTrace(entry.second.as<std::string>());
+    }
+}
+
+void MKLDNNExecNetwork::dumpPerfTrace(const std::string &file) {
+    std::vector<MKLDNNGraph::Ptr> graphs;
+    for (auto &&graph : _graphs)
+        graphs.push_back(graph);
+
+    // concurrent requests of the trace write to the same file
+    std::lock_guard<std::mutex> lock{_perfTraceMutex};
+    std::ofstream trace(file);
+    if (!trace.is_open())
+        THROW_IE_EXCEPTION << "CPU Plugin cannot create trace file " << file << ".";
+    dump_perf_trace(graphs, trace);
+}
+
+void MKLDNNExecNetwork::setExportData(const std::shared_ptr<ngraph::Function> &function,
+                                      bool transformed,
+                                      const std::map<std::string, std::string> &config) {
+    _exportFunction = function;
+    _exportTransformed = transformed;
+    _exportConfig = config;
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream &modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+
+    if (!_exportFunction)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export is supported only for networks represented by ngraph::Function "
+                           << "and loaded with KEY_CPU_EXPORTABLE or KEY_CACHE_DIR";
+
+    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    serializer.serialize(_exportFunction, _exportTransformed, _networkInputs, _networkOutputs, _exportConfig);
+}
+
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
@@ -306,6 +586,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -320,6 +601,16 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS)) {
+        std::map<std::string, uint64_t> statistics;
+        for (auto && numaNode : _numaNodesWeights.GetStatistics()) {
+            const auto prefix = "NUMA_NODE_" + std::to_string(numaNode.first) + "_";
+            statistics[prefix + "HITS"] = numaNode.second.hits;
+            statistics[prefix + "MISSES"] = numaNode.second.misses;
+            statistics[prefix + "BYTES"] = numaNode.second.bytes;
+            statistics[prefix + "BYTES_SAVED"] = numaNode.second.bytesSaved;
+        }
+        IE_SET_METRIC_RETURN(CPU_WEIGHTS_CACHE_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -7,12 +7,16 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "mkldnn_graph.h"
+#include "mkldnn_graph_cache.h"
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_istreams_executor.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <functional>
 #include <string>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
@@ -32,16 +36,67 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
-    ~MKLDNNExecNetwork() override = default;
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Only KEY_CPU_PERF_COUNT_TRACE is supported, the trace of all stream graphs is written to the given file.
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    /**
+     * @brief Stores the network function, so the network can be exported.
+     * @param function a copy of the network function
+     * @param transformed true if the function is taken after the plugin transformations which keep it in the IR opsets
+     * @param config configuration the network was loaded with
+     */
+    void setExportData(const std::shared_ptr<ngraph::Function> &function,
+                       bool transformed,
+                       const std::map<std::string, std::string> &config);
+
+    using DynamicShapesBuilder = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes &)>;
+
+    /**
+     * @brief Enables dynamic shapes mode.
+     * @param builder a function which returns the network reshaped to the input dimensions and converted
+     * to the form the plugin creates graphs from
+     */
+    void setDynamicShapesBuilder(DynamicShapesBuilder builder);
+
+    using DynamicShapesInference =
+        std::function<std::map<std::string, InferenceEngine::SizeVector>(const InferenceEngine::ICNNNetwork::InputShapes &)>;
+
+    /**
+     * @brief Enables reinitialization of the compiled network for new input dimensions in dynamic shapes mode.
+     * @param inference a function which returns dimensions of all data of the network for the input dimensions,
+     * data is named as in the network passed to the plugin
+     */
+    void setDynamicShapesInference(DynamicShapesInference inference);
+
+    /**
+     * @brief Returns the graph of the current stream compiled for the dimensions of the input blobs.
+     * In dynamic shapes mode graphs for the dimensions which differ from the network ones are created
+     * on demand and kept in the LRU cache of the stream.
+     */
+    MKLDNNGraph::Ptr GetGraph(const InferenceEngine::BlobMap &inputs);
+
+    bool isDynamicShapes() const {
+        return static_cast<bool>(_dynamicShapesBuilder);
+    }
+
+    /**
+     * @brief Writes kept executions of the nodes of all stream graphs into one Chrome trace file.
+     * @param file a path to the trace file
+     */
+    void dumpPerfTrace(const std::string &file);
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -50,15 +105,41 @@ public:
 protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // refers to the plugin weights caches, used to report their statistics
+    NumaNodesWeights            _numaNodesWeights;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::CNNNetwork                 _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    std::mutex                                  _perfTraceMutex;
+
+
+    std::shared_ptr<ngraph::Function>           _exportFunction;
+    bool                                        _exportTransformed = false;
+    std::map<std::string, std::string>          _exportConfig;
 
+    DynamicShapesBuilder                        _dynamicShapesBuilder;
+    DynamicShapesInference                      _dynamicShapesInference;
+    enum class ShapesReinitialization {Unknown, Supported, Unsupported};
+    ShapesReinitialization                      _shapesReinitialization = ShapesReinitialization::Unknown;
+    std::mutex                                  _dynamicShapesMutex;
+    InferenceEngine::ThreadLocal<MKLDNNGraphCache::Ptr> _dynamicGraphs;
+    // _taskExecutor can be wrapped, so the streams executor is kept to find NUMA node of the stream
+    InferenceEngine::IStreamsExecutor*          _streamsExecutor = nullptr;
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
+
+    // Applies the transformations of legacy layers required to create a graph
+    void PrepareNetwork(InferenceEngine::CNNNetwork &network) const;
+
+    // Copies the compiled network with the dimensions of data inferred for the input dimensions, returns false
+    // if the compiled network cannot be reused for them. Called under _dynamicShapesMutex.
+    bool ReshapeCompiledNetwork(const InferenceEngine::ICNNNetwork::InputShapes &shapes,
+                                InferenceEngine::CNNNetwork &network);
+
+    void ExportImpl(std::ostream &modelStream) override;
 };
 
 }  // namespace MKLDNNPlugin
@@ -15,6 +15,17 @@ void MKLDNNExtensionManager::AddExtension(IExtensionPtr extension) {
     _extensions.push_back(extension);
 }
 
+std::map<std::string, ngraph::OpSet> MKLDNNExtensionManager::GetOpSets() const {
+    std::map<std::string, ngraph::OpSet> opsets;
+    for (const auto& ext : _extensions) {
+        // the first registered extension wins in case of the opset name collision
+        for (const auto& opset : ext->getOpSets()) {
+            opsets.insert(opset);
+        }
+    }
+    return opsets;
+}
+
 InferenceEngine::ILayerImpl::Ptr MKLDNNExtensionManager::CreateImplementation(const std::shared_ptr<ngraph::Node>& op) {
     if (!op)
         THROW_IE_EXCEPTION << "Cannot get nGraph operation!";
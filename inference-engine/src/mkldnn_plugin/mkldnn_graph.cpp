@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -89,13 +90,17 @@ template void MKLDNNGraph::ApplyUnrollPasses(CNNNetwork&);
 
 template<typename NET>
 void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
-        MKLDNNWeightsSharing::Ptr &w_cache) {
+        MKLDNNWeightsSharing::Ptr &w_cache, const std::shared_ptr<const MKLDNNGraph> &templ) {
     OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
 
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    templateGraph = templ;
+    // primitives are shared with the template graph, they can be executed only on the engine they were created on
+    if (templateGraph)
+        eng = templateGraph->eng;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -103,9 +108,9 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
 }
 
 template void MKLDNNGraph::CreateGraph(const TensorIterator::Body&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const std::shared_ptr<const MKLDNNGraph>&);
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
-        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
+        const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&, const std::shared_ptr<const MKLDNNGraph>&);
 
 void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -343,10 +348,18 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    if (config.interOpParallel)
+        InitInterOpStages();
+
     Allocate();
 
     CreatePrimitives();
 
+    if (config.collectPerfCounters && config.perfCountHistory > 0) {
+        for (auto &graphNode : graphNodes)
+            graphNode->PerfCounter().enableHistory(config.perfCountHistory);
+    }
+
     SetOriginalLayerNames();
 
     if (!config.dumpToDot.empty())
@@ -425,19 +438,94 @@ void MKLDNNGraph::InitDescriptors() {
         OV_ITT_TASK_NEXT(taskChain, node->profiling.getSupportedDescriptors);
         node->getSupportedDescriptors();
 
+        if (ShareTemplateSupportedDescriptors(node))
+            continue;
+
         OV_ITT_TASK_NEXT(taskChain, node->profiling.initSupportedPrimitiveDescriptors);
         node->initSupportedPrimitiveDescriptors();
 
         OV_ITT_TASK_NEXT(taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
         node->filterSupportedPrimitiveDescriptors();
+
+        if (CanBeTemplate() && EnumeratesImplementations(node))
+            supportedDescriptors[node->getName()] = {DescriptorsSignature(node), node->getSupportedPrimitiveDescriptors()};
     }
 
     for (auto &node : graphNodes) {
         OV_ITT_TASK_NEXT(taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        if (!SelectTemplatePrimitiveDescriptor(node))
+            node->selectOptimalPrimitiveDescriptor();
+        selectedDescriptors[node->getName()] = {node->selectedPrimitiveDescriptorIndex,
+                                                node->getSupportedPrimitiveDescriptors().size()};
     }
 }
 
+bool MKLDNNGraph::EnumeratesImplementations(const MKLDNNNodePtr &node) {
+    // Supported descriptors of these nodes are created by iterating over MKLDNN implementations, which is
+    // the most expensive part of the descriptors initialization. Their initSupportedPrimitiveDescriptors()
+    // fills only the list of supported descriptors, so the list can be copied from the template node.
+    switch (node->getType()) {
+        case Convolution:
+        case Deconvolution:
+        case FullyConnected:
+        case Pooling:
+        case BatchNormalization:
+        case Lrn:
+        case SoftMax:
+        case RNNCell:
+        case RNNSeq:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string MKLDNNGraph::DescriptorsSignature(const MKLDNNNodePtr &node) {
+    // The descriptors depend on the dims of inputs and outputs (a template can have other input shapes)
+    // and on the fused post operations
+    std::string signature;
+    auto appendDims = [&] (const MKLDNNDims &dims) {
+        for (auto dim : dims.ToSizeVector())
+            signature += std::to_string(dim) + ",";
+        signature += ";";
+    };
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        appendDims(node->getParentEdgeAt(i)->getDims());
+    signature += "->";
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        appendDims(node->getChildEdgeAt(i)->getDims());
+    for (auto &fused : node->getFusedWith())
+        signature += fused->getName() + ";";
+    return signature;
+}
+
+bool MKLDNNGraph::ShareTemplateSupportedDescriptors(const MKLDNNNodePtr &node) {
+    if (!templateGraph || !EnumeratesImplementations(node))
+        return false;
+
+    auto found = templateGraph->supportedDescriptors.find(node->getName());
+    if (found == templateGraph->supportedDescriptors.end() || found->second.first != DescriptorsSignature(node))
+        return false;
+
+    node->supportedPrimitiveDescriptors = found->second.second;
+    return true;
+}
+
+bool MKLDNNGraph::SelectTemplatePrimitiveDescriptor(const MKLDNNNodePtr &node) {
+    if (!templateGraph)
+        return false;
+
+    // Graph optimizations are deterministic, so the template has a node with the same name and
+    // the same list of supported descriptors. The check protects against nodes which differ anyway.
+    auto found = templateGraph->selectedDescriptors.find(node->getName());
+    if (found == templateGraph->selectedDescriptors.end() ||
+        found->second.second != node->getSupportedPrimitiveDescriptors().size())
+        return false;
+
+    node->selectPrimitiveDescriptorByIndex(found->second.first);
+    return node->getSelectedPrimitiveDescriptor() != nullptr;
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -448,6 +536,10 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
+    // constant outputs already contain data computed by the template graph
+    if (constantsShared)
+        return;
+
     mkldnn::stream stream(eng);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
@@ -491,6 +583,34 @@ void MKLDNNGraph::InitEdges() {
     }
 }
 
+void MKLDNNGraph::InitInterOpStages() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitInterOpStages");
+
+    // Stage of a node is the length of the longest path to it from the graph inputs.
+    // So all the producers of a node are placed into the previous stages. Constant nodes
+    // are executed only once on load and don't impose any dependencies.
+    // Stages are separated by a barrier in InferStages(): the memory plan measures tensor lifetimes in stages,
+    // so a node may not start before all the nodes of the previous stages complete.
+    execStages.assign(graphNodes.size(), 0);
+    interOpStages.clear();
+
+    for (auto &node : graphNodes) {
+        int stage = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                stage = std::max(stage, execStages[parent->execIndex] + 1);
+        }
+        execStages[node->execIndex] = stage;
+
+        if (node->isConstant())
+            continue;
+        if (interOpStages.size() <= static_cast<size_t>(stage))
+            interOpStages.resize(stage + 1);
+        interOpStages[stage].push_back(node);
+    }
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -565,13 +685,26 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In case of inter-op execution all nodes of one stage are alive simultaneously,
+    // so the lifetime of a tensor is measured in stages instead of execution indexes.
+    auto execTime = [&] (const MKLDNNNodePtr &node) {
+        return execStages.empty() ? node->execIndex : execStages[node->execIndex];
+    };
+
+    // Constant clusters of a graph created from a template are placed into the memory of the template graph
+    std::vector<void*> constData(edge_clasters.size(), nullptr);
+    constantsShared = templateGraph && ShareTemplateConstants(edge_clasters, constData);
+    if (!constantsShared)
+        std::fill(constData.begin(), constData.end(), nullptr);
+
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    std::vector<bool> constClusters(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execTime(edge->getParent());
+            int e_finish = execTime(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -615,11 +748,34 @@ void MKLDNNGraph::AllocateWithReuse() {
             }
         }
 
-        box.size = div_up(box.size, alignment);
+        box.size = constData[i] ? 0 : div_up(box.size, alignment);
+        constClusters[i] = isConst;
+    }
+
+    std::vector<int64_t> offsets(boxes.size());
+    int64_t solvedSize = 0;
+    if (!ReuseTemplateMemoryLayout(boxes, offsets, solvedSize)) {
+        MemorySolver memSolver(boxes);
+        solvedSize = memSolver.solve();
+        for (int i = 0; i < boxes.size(); i++)
+            offsets[i] = memSolver.getOffset(i);
+    }
+
+    // Graphs created from this one take its constants, so their constant clusters need no memory
+    if (CanBeTemplate()) {
+        sharedConstantsLayout.boxes = boxes;
+        for (int i = 0; i < boxes.size(); i++) {
+            if (constClusters[i])
+                sharedConstantsLayout.boxes[i].size = 0;
+        }
+        MemorySolver memSolver(sharedConstantsLayout.boxes);
+        sharedConstantsLayout.size = memSolver.solve();
+        sharedConstantsLayout.offsets.resize(boxes.size());
+        for (int i = 0; i < boxes.size(); i++)
+            sharedConstantsLayout.offsets[i] = memSolver.getOffset(i);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    size_t total_size = static_cast<size_t>(solvedSize) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -628,8 +784,11 @@ void MKLDNNGraph::AllocateWithReuse() {
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
-            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation && constData[i]) {
+                edge->allocate(constData[i]);
+                count++;
+            } else if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+                int64_t offset = offsets[i];
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
@@ -647,6 +806,67 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+bool MKLDNNGraph::ReuseTemplateMemoryLayout(const std::vector<MemorySolver::Box> &boxes,
+                                            std::vector<int64_t> &offsets, int64_t &size) const {
+    if (!templateGraph || !constantsShared)
+        return false;
+
+    // The solver result depends only on the boxes, so it is reused if they are equal
+    const auto &layout = templateGraph->sharedConstantsLayout;
+    auto equal = [] (const MemorySolver::Box &lhs, const MemorySolver::Box &rhs) {
+        return lhs.start == rhs.start && lhs.finish == rhs.finish && lhs.size == rhs.size && lhs.id == rhs.id;
+    };
+    if (layout.boxes.size() != boxes.size() || !std::equal(boxes.begin(), boxes.end(), layout.boxes.begin(), equal))
+        return false;
+
+    offsets = layout.offsets;
+    size = layout.size;
+    return true;
+}
+
+bool MKLDNNGraph::ShareTemplateConstants(const std::vector<std::vector<MKLDNNEdgePtr>> &edgeClusters,
+                                         std::vector<void*> &constData) {
+    auto edgeKey = [] (const MKLDNNEdgePtr &edge) {
+        return edge->getParent()->getName() + ":" + std::to_string(edge->getInputNum()) + "->" +
+               edge->getChild()->getName() + ":" + std::to_string(edge->getOutputNum());
+    };
+
+    // The template graph is completely initialized, so its edges are only read here
+    std::unordered_map<std::string, MKLDNNEdgePtr> templateEdges;
+    for (auto &edge : templateGraph->graphEdges)
+        templateEdges[edgeKey(edge)] = edge;
+
+    for (size_t i = 0; i < edgeClusters.size(); i++) {
+        bool isConst = false;
+        for (auto &edge : edgeClusters[i])
+            isConst |= isConstOutput(edge);
+        if (!isConst)
+            continue;
+
+        for (auto &edge : edgeClusters[i]) {
+            if (edge->getStatus() != MKLDNNEdge::Status::NeedAllocation)
+                continue;
+
+            auto found = templateEdges.find(edgeKey(edge));
+            if (found == templateEdges.end())
+                return false;
+            auto &templateEdge = found->second;
+            if (!templateEdge->memoryPtr || templateEdge->inputDesc != edge->getDesc())
+                return false;
+            constData[i] = templateEdge->memoryPtr->GetData();
+        }
+    }
+
+    // Constant nodes are not executed at all, so partial sharing is not allowed
+    for (size_t i = 0; i < edgeClusters.size(); i++) {
+        for (auto &edge : edgeClusters[i]) {
+            if (isConstOutput(edge) && !constData[i])
+                return false;
+        }
+    }
+    return true;
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -667,13 +887,24 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
+    // nodes of a graph created from a template take the primitives of the template nodes instead of creating them
+    std::unordered_map<std::string, MKLDNNNodePtr> templateNodes;
+    if (templateGraph) {
+        for (auto &node : templateGraph->graphNodes)
+            templateNodes[node->getName()] = node;
+    }
+
     for (auto& node : graphNodes) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        auto templateNode = templateNodes.find(node->getName());
+        if (templateNode != templateNodes.end())
+            node->templateNode = templateNode->second;
         node->createPrimitive();
+        node->templateNode.reset();
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool applyMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -693,7 +924,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (applyMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -760,29 +991,84 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    // The execution mode is fixed on graph initialization, since the memory plan depends on it
+    if (!interOpStages.empty()) {
+        InferStages(batch);
+    } else {
+        mkldnn::stream stream(eng);
 
-    for (int i = 0; i < graphNodes.size(); i++) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (IsCancellationRequested()) {
+                ResetCancellationRequest();
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
+            }
+
+            PERF(graphNodes[i]);
+
+            if (batch > 0)
+                graphNodes[i]->setDynamicBatchLim(batch);
+
+            ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+
+            if (!graphNodes[i]->isConstant()) {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
+                graphNodes[i]->execute(stream);
+            }
+            ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        }
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+void MKLDNNGraph::InferStages(int batch) {
+    auto executeNode = [&] (const MKLDNNNodePtr &node, mkldnn::stream &stream) {
+        PERF(node);
+
+        if (batch > 0)
+            node->setDynamicBatchLim(batch);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            node->execute(stream);
+        }
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    };
+
+    for (auto &stage : interOpStages) {
         if (IsCancellationRequested()) {
             ResetCancellationRequest();
             THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
         }
 
-        PERF(graphNodes[i]);
-
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+        if (stage.size() == 1) {
+            mkldnn::stream stream(eng);
+            executeNode(stage[0], stream);
+            continue;
+        }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+        // Nodes are executed as tasks of the current stream arena, so intra-op parallel_for calls
+        // of the nodes are nested into them and share the same threads.
+        // Exceptions are collected and re-thrown on the calling thread, since OpenMP regions can't propagate them.
+        std::vector<std::exception_ptr> exceptions(stage.size());
+        const int nthr = std::min(static_cast<int>(stage.size()), parallel_get_max_threads());
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            mkldnn::stream stream(eng);
+            for_1d(ithr, nthr, stage.size(), [&](size_t i) {
+                try {
+                    executeNode(stage[i], stream);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+        });
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+        for (auto &exception : exceptions) {
+            if (exception)
+                std::rethrow_exception(exception);
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
-
-    if (infer_count != -1) infer_count++;
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -11,9 +11,12 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_memory_solver.hpp"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <atomic>
@@ -51,16 +54,29 @@ public:
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
+    /**
+     * @brief Creates the graph for the network.
+     * If the template graph is specified, it should be created for the same network and configuration,
+     * the network may have other dimensions of data.
+     * Primitive descriptors selected for the template graph are reused without selection heuristics,
+     * and constant data computed by the template graph is shared instead of being recomputed.
+     * The template graph is kept alive while this graph exists and should not be changed.
+     */
     template<typename NET>
     void CreateGraph(const NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
-                     MKLDNNWeightsSharing::Ptr &w_cache);
+                     MKLDNNWeightsSharing::Ptr &w_cache,
+                     const std::shared_ptr<const MKLDNNGraph> &templateGraph = nullptr);
 
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * Sets data of the input node. Mean values or mean image of the input are subtracted
+     * unless they were already applied by the input pre-processing (applyMean is false).
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool applyMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
@@ -148,6 +164,12 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        interOpStages.clear();
+        execStages.clear();
+        selectedDescriptors.clear();
+        supportedDescriptors.clear();
+        constantsShared = false;
+        sharedConstantsLayout = {};
     }
     Status status;
     Config config;
@@ -168,6 +190,30 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Inter-op execution plan. Nodes of one stage have no data dependencies between each other
+    // and are executed concurrently. Constant nodes are not included.
+    std::vector<std::vector<MKLDNNNodePtr>> interOpStages;
+    // Stage index for each node, indexed by node execIndex
+    std::vector<int> execStages;
+
+    // Graph which the current graph was created from, it owns the shared constant data
+    std::shared_ptr<const MKLDNNGraph> templateGraph;
+    // Primitive descriptor index selected for a node by name and number of supported descriptors of the node
+    std::unordered_map<std::string, std::pair<int, size_t>> selectedDescriptors;
+    // Supported primitive descriptors of the nodes enumerating MKLDNN implementations by node name, with the signature
+    // of the node they were created for. Graphs created from the template copy them instead of enumerating again.
+    std::unordered_map<std::string, std::pair<std::string, std::vector<PrimitiveDescInfo>>> supportedDescriptors;
+    // Constant data is taken from the template graph, so constant nodes are not executed
+    bool constantsShared = false;
+    // Memory solver input and offsets of the graphs created from the template with shared constants,
+    // the template solves it once for all of them
+    struct MemoryLayout {
+        std::vector<MemorySolver::Box> boxes;
+        std::vector<int64_t> offsets;
+        int64_t size = 0;
+    };
+    MemoryLayout sharedConstantsLayout;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -175,12 +221,26 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    static bool EnumeratesImplementations(const MKLDNNNodePtr &node);
+    static std::string DescriptorsSignature(const MKLDNNNodePtr &node);
+    bool ShareTemplateSupportedDescriptors(const MKLDNNNodePtr &node);
+    bool SelectTemplatePrimitiveDescriptor(const MKLDNNNodePtr &node);
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitInterOpStages();
     void Allocate();
     void AllocateWithReuse();
+    bool ShareTemplateConstants(const std::vector<std::vector<MKLDNNEdgePtr>> &edgeClusters,
+                                std::vector<void*> &constData);
+    bool ReuseTemplateMemoryLayout(const std::vector<MemorySolver::Box> &boxes,
+                                   std::vector<int64_t> &offsets, int64_t &size) const;
+    // The first graph of a network loaded with several streams becomes the template of the other stream graphs
+    bool CanBeTemplate() const {
+        return !templateGraph && config.streamExecutorConfig._streams != 1;
+    }
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void InferStages(int batch);
     void SetOriginalLayerNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
@@ -190,6 +250,7 @@ protected:
     friend class MKLDNNGraphlessInferRequest;
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph);
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+    friend void dump_perf_trace(const std::vector<MKLDNNGraph::Ptr> &graphs, std::ostream &out);
 
 private:
     void dumpToDotFile(std::string file) const;
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_graph_cache.h"
+
+namespace MKLDNNPlugin {
+
+MKLDNNGraphCache::MKLDNNGraphCache(size_t capacity) : _capacity(capacity) {
+    if (_capacity == 0)
+        THROW_IE_EXCEPTION << "Capacity of graphs cache must be positive";
+}
+
+MKLDNNGraph::Ptr MKLDNNGraphCache::findOrCreate(const Key& key, const std::function<MKLDNNGraph::Ptr()>& create) {
+    auto found = _index.find(key);
+    if (found != _index.end()) {
+        _graphs.splice(_graphs.begin(), _graphs, found->second);
+        return found->second->second;
+    }
+
+    auto graph = create();
+    if (_graphs.size() == _capacity) {
+        _index.erase(_graphs.back().first);
+        _graphs.pop_back();
+    }
+    _graphs.emplace_front(key, graph);
+    _index[key] = _graphs.begin();
+    return graph;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+#include "mkldnn_graph.h"
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * LRU cache of graphs compiled for different input dimensions of the network.
+ * Graphs are not thread safe, so each stream has its own cache and the cache is not thread safe as well.
+ */
+class MKLDNNGraphCache {
+public:
+    using Ptr = std::shared_ptr<MKLDNNGraphCache>;
+    using Key = InferenceEngine::ICNNNetwork::InputShapes;
+
+    explicit MKLDNNGraphCache(size_t capacity);
+
+    /**
+     * Returns the graph compiled for the input dimensions, the graph is created if it is not found.
+     * The least recently used graph is released if the cache is full.
+     */
+    MKLDNNGraph::Ptr findOrCreate(const Key& key, const std::function<MKLDNNGraph::Ptr()>& create);
+
+private:
+    using Entry = std::pair<Key, MKLDNNGraph::Ptr>;
+
+    size_t _capacity;
+    std::list<Entry> _graphs;  // the most recently used graph is the first
+    std::map<Key, std::list<Entry>::iterator> _index;
+};
+
+}  // namespace MKLDNNPlugin
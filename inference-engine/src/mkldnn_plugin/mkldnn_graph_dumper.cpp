@@ -11,6 +11,9 @@
 #include "generic_ie.hpp"
 #include <ngraph/variant.hpp>
 
+#include <algorithm>
+#include <iomanip>
+#include <limits>
 #include <vector>
 #include <string>
 #include <memory>
@@ -24,6 +27,8 @@ namespace {
 
 std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &);
 void drawer_callback(const InferenceEngine::CNNLayerPtr, ordered_properties &, ordered_properties &);
+std::string ns_to_us_string(uint64_t ns);
+std::string json_string(const std::string &str);
 
 }  // namespace
 
@@ -199,6 +204,50 @@ void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
     InferenceEngine::saveGraphToDot(dump_net, out, drawer_callback);
 }
 
+void dump_perf_trace(const std::vector<MKLDNNGraph::Ptr> &graphs, std::ostream &out) {
+    // timestamps of the trace start from the earliest kept execution of all graphs, so the streams are aligned in time
+    uint64_t origin = std::numeric_limits<uint64_t>::max();
+    for (auto &graph : graphs) {
+        for (auto &node : graph->graphNodes) {
+            for (auto &sample : node->PerfCounter().samples())
+                origin = (std::min)(origin, sample.start);
+        }
+    }
+
+    out << "{\n\"displayTimeUnit\": \"ns\",\n\"traceEvents\": [\n";
+    for (size_t stream = 0; stream < graphs.size(); stream++) {
+        out << (stream ? ",\n" : "") << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << stream
+            << ", \"args\": {\"name\": " << json_string(graphs[stream]->_name + " (stream " + std::to_string(stream) + ")") << "}}";
+    }
+
+    for (size_t stream = 0; stream < graphs.size(); stream++) {
+        // nodes fused into or merged with the executed node have no executions of their own, they are nested into its ones
+        auto dump_event = [&](const MKLDNNNodePtr &node, const PerfSample &sample, const std::string &args) {
+            out << ",\n{\"name\": " << json_string(node->getName()) << ", \"cat\": " << json_string(node->getTypeStr())
+                << ", \"ph\": \"X\", \"pid\": " << stream << ", \"tid\": " << sample.thread
+                << ", \"ts\": " << ns_to_us_string(sample.start - origin) << ", \"dur\": " << ns_to_us_string(sample.finish - sample.start)
+                << ", \"args\": {" << args << "}}";
+        };
+        for (auto &node : graphs[stream]->graphNodes) {
+            auto samples = node->PerfCounter().samples();
+            if (samples.empty())
+                continue;
+
+            std::string args = "\"execType\": " + json_string(node->getPrimitiveDescriptorType()) +
+                               ", \"p50 (us)\": " + ns_to_us_string(node->PerfCounter().percentile(50)) +
+                               ", \"p99 (us)\": " + ns_to_us_string(node->PerfCounter().percentile(99));
+            for (auto &sample : samples) {
+                dump_event(node, sample, args);
+                for (auto &fused : node->getFusedWith())
+                    dump_event(fused, sample, "\"fusedInto\": " + json_string(node->getName()));
+                for (auto &merged : node->getMergeWith())
+                    dump_event(merged, sample, "\"mergedWith\": " + json_string(node->getName()));
+            }
+        }
+    }
+    out << "\n]\n}\n";
+}
+
 //**********************************
 // Special converters of meta data
 //**********************************
@@ -282,6 +331,10 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
+    if (!node->PerfCounter().samples().empty()) {
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P50] = ns_to_us_string(node->PerfCounter().percentile(50));
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_P99] = ns_to_us_string(node->PerfCounter().percentile(99));
+    }
 
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
@@ -323,6 +376,28 @@ void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
     node_properties.push_back({"xlabel", (perf != layer->params.end()) ? perf->second : ""});
 }
 
+std::string ns_to_us_string(uint64_t ns) {
+    std::stringstream ss;
+    ss << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+    return ss.str();
+}
+
+std::string json_string(const std::string &str) {
+    std::stringstream ss;
+    ss << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            ss << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            ss << c;
+        }
+    }
+    ss << '"';
+    return ss.str();
+}
+
 }  // namespace
 
 }  // namespace MKLDNNPlugin
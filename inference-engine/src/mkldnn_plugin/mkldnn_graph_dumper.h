@@ -8,11 +8,18 @@
 #include "mkldnn_graph.h"
 
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out);
 
+/**
+ * Writes the kept executions of the nodes of the stream graphs in one Chrome trace event JSON.
+ * A trace process corresponds to a stream graph and a trace thread to a thread which executed its nodes.
+ */
+void dump_perf_trace(const std::vector<MKLDNNGraph::Ptr> &graphs, std::ostream &out);
+
 InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph);
 InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
 
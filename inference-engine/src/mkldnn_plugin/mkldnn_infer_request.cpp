@@ -11,6 +11,7 @@
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <debug.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
 #include "nodes/common/cpu_convert.h"
@@ -68,7 +69,8 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
+void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec,
+                                                 bool applyMean) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
     if (inputBlob->cbuffer().as<const void *>() == nullptr) {
@@ -92,7 +94,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, applyMean);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
@@ -102,6 +104,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
         }
         auto inPrec = input.second->getTensorDesc().getPrecision();
 
+        // mean values are already applied if the input was normalized by the pre-processing
+        const bool applyMean = graph->hasMeanImageFor(input.first) &&
+                               !(_preProcData.find(input.first) != _preProcData.end() &&
+                                 _networkInputs[input.first]->getPreProcess().getFusedNormalization());
+
         switch (inPrec) {
             // these precisions are supported by mkldnn, so we push the blob directly
             case InferenceEngine::Precision::I8:
@@ -114,7 +121,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             // BUT if a mean image exists, we convert the blob and send FP32
             case InferenceEngine::Precision::U8:
             case InferenceEngine::Precision::BOOL: {
-                if (graph->hasMeanImageFor(input.first))
+                if (applyMean)
                     inPrec = InferenceEngine::Precision::FP32;
                 break;
             }
@@ -129,72 +136,144 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             default:
                 THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
         }
-        pushInput(input.first, input.second, inPrec);
+        pushInput(input.first, input.second, inPrec, applyMean);
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::BindStates() {
+    // States are kept by the request, so several requests with their own states can run on the same stream
+    // graph one after another. The graph reads and writes the state blobs directly, without copying.
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                    auto state_blob = std::const_pointer_cast<InferenceEngine::Blob>(state->GetState());
+                    if (state_blob->byteSize() != cur_node->getStore()->GetSize())
+                        THROW_IE_EXCEPTION << "State " << cur_id << " has incorrect size: " << state_blob->byteSize()
+                                           << " bytes instead of " << cur_node->getStore()->GetSize();
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    cur_node->bindState(state_blob->buffer());
                 }
             }
         }
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::UnbindStates() {
+    // The state blobs may be released together with the request, so the graph shared by other requests of
+    // the stream must not keep pointers to them after the inference.
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+            dynamic_cast<MKLDNNMemoryInputNode*>(node.get())->bindState(nullptr);
         }
     }
 }
 
-
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
-    graph = execNetwork->_graphs.local().get();
+    currentGraph = execNetwork->GetGraph(_inputs);
+    graph = currentGraph.get();
 
     execDataPreprocessing(_inputs);
 
+    if (execNetwork->isDynamicShapes()) {
+        ReallocateOutputs();
+    }
+
     changeDefaultPtr();
 
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        struct StatesGuard {
+            explicit StatesGuard(MKLDNNInferRequest* request) : _request{request} {
+                try {
+                    _request->BindStates();
+                } catch (...) {
+                    _request->UnbindStates();
+                    throw;
+                }
+            }
+            ~StatesGuard() {
+                _request->UnbindStates();
+            }
+            MKLDNNInferRequest* _request;
+        } statesGuard{this};
+
+        graph->Infer(m_curBatch);
+    } else {
+        graph->Infer(m_curBatch);
     }
 
-    graph->Infer(m_curBatch);
+    graph->PullOutputData(_outputs);
+}
 
-    if (memoryStates.size() != 0) {
-        PullStates();
+void MKLDNNPlugin::MKLDNNInferRequest::ReallocateOutputs() {
+    // In dynamic shapes mode output dims depend on the input ones, so the output blobs are replaced
+    // when the graph produces outputs of other dims. Blobs set by the user are reshaped instead if their
+    // memory is enough for the new dims.
+    for (auto& output : _outputs) {
+        MKLDNNNodePtr outputNode;
+        for (auto& out : graph->outputNodes) {
+            if (out->getName() == "out_" + output.first) {
+                outputNode = out;
+                break;
+            }
+        }
+        if (!outputNode)
+            continue;
+
+        auto dims = outputNode->getParentEdgeAt(0)->getDims().ToSizeVector();
+        auto& desc = output.second->getTensorDesc();
+        if (desc.getDims() == dims)
+            continue;
+
+        auto userOutput = userOutputsSize.find(output.first);
+        if (userOutput != userOutputsSize.end()) {
+            if (InferenceEngine::details::product(dims) > userOutput->second) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Output blob " << output.first << " of "
+                                   << userOutput->second << " elements is too small for the output dims "
+                                   << InferenceEngine::details::dumpVec(dims);
+            }
+            auto layout = desc.getDims().size() == dims.size() ? desc.getLayout()
+                                                                : InferenceEngine::TensorDesc::getLayoutByDims(dims);
+            desc.reshape(dims, layout);
+            continue;
+        }
+
+        output.second = make_blob_with_precision(
+            InferenceEngine::TensorDesc(desc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)));
+        output.second->allocate();
+        auto ptr = externalPtr.find(output.first);
+        if (ptr != externalPtr.end()) {
+            ptr->second = output.second->buffer();
+        }
     }
+}
 
-    graph->PullOutputData(_outputs);
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::blobRefDims(const std::string& name, bool isInput) const {
+    // Blobs of any dims are accepted in dynamic shapes mode except the inputs with preprocessing,
+    // which are resized to the network input dims
+    if (!execNetwork->isDynamicShapes() || (isInput && _preProcData.find(name) != _preProcData.end()))
+        return {};
+    auto& blobs = isInput ? _inputs : _outputs;
+    auto blob = blobs.find(name);
+    if (blob == blobs.end() || !blob->second)
+        return {};
+    return blob->second->getTensorDesc().getDims();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, blobRefDims(input.first, true));
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, blobRefDims(output.first, false));
+    }
 }
 
 InferenceEngine::StatusCode MKLDNNPlugin::MKLDNNInferRequest::Cancel() {
@@ -207,6 +286,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
     graph->GetPerfData(perfMap);
+    getPreProcessingPerformanceCounts(perfMap);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -228,7 +308,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, blobRefDims(name, true));
             return;
         }
 
@@ -257,7 +337,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, blobRefDims(name, false));
             return;
         }
 
@@ -313,27 +393,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         }
 
         if (preProcRequired) {
-            if (_preProcData.find(name) == _preProcData.end()) {
-                _preProcData.emplace(name, InferenceEngine::CreatePreprocDataHelper());
-            }
-            _preProcData[name]->isApplicable(data, _inputs[name]);
-            // Stores the given blob as ROI blob. It will be used to fill in network input during
-            // pre-processing
-            _preProcData[name]->setRoiBlob(data);
+            addInputPreProcessingFor(name, data, _inputs[name]);
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
                 : 1;
-            if (dataSize != inputSize) {
+            if (!execNetwork->isDynamicShapes() && dataSize != inputSize) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            if (!execNetwork->isDynamicShapes() && foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
             }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+            if (!execNetwork->isDynamicShapes() &&
+                data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
                 foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
             }
@@ -358,14 +433,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
-        if (dataSize != outputSize) {
+        if (!execNetwork->isDynamicShapes() && dataSize != outputSize) {
             THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
                                << dataSize << "!=" << outputSize << ").";
         }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+        if (!execNetwork->isDynamicShapes() && foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
         }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+        if (!execNetwork->isDynamicShapes() &&
+            data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
@@ -376,6 +452,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputsSize[name] = data->size();
     }
 }
 
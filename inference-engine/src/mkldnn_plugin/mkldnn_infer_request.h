@@ -47,17 +47,27 @@ public:
 
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+protected:
+    void checkBlobs() override;
+
 private:
     void PushInputData();
-    void PushStates();
-    void PullStates();
+    void BindStates();
+    void UnbindStates();
+    void ReallocateOutputs();
+    InferenceEngine::SizeVector blobRefDims(const std::string& name, bool isInput) const;
 
-    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType,
+                   bool applyMean);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps the graph from the dynamic shapes cache alive while the request uses it
+    MKLDNNGraph::Ptr                    currentGraph;
     std::map<std::string, void*>        externalPtr;
+    // number of elements of the output blobs set by the user, they are reshaped in dynamic shapes mode
+    std::map<std::string, size_t>       userOutputsSize;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
 };
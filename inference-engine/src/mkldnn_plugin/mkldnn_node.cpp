@@ -506,6 +506,43 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+std::shared_ptr<mkldnn::primitive> MKLDNNNode::getTemplatePrimitive() const {
+    if (!templateNode || !templateNode->prim || templateNode->getType() != getType())
+        return nullptr;
+
+    // the primitive is defined by the selected implementation, the memory descriptors of the edges and the fused nodes
+    auto selected = getSelectedPrimitiveDescriptor();
+    auto templateSelected = templateNode->getSelectedPrimitiveDescriptor();
+    if (!selected || !templateSelected || selected->getImplementationType() != templateSelected->getImplementationType())
+        return nullptr;
+
+    auto sameEdges = [](const std::vector<MKLDNNEdgeWeakPtr> &edges, const std::vector<MKLDNNEdgeWeakPtr> &templateEdges) {
+        if (edges.size() != templateEdges.size())
+            return false;
+        for (size_t i = 0; i < edges.size(); i++) {
+            auto edge = edges[i].lock();
+            auto templateEdge = templateEdges[i].lock();
+            if (!edge || !templateEdge || edge->getDesc() != templateEdge->getDesc())
+                return false;
+        }
+        return true;
+    };
+    auto sameNodes = [](const std::vector<MKLDNNNodePtr> &nodes, const std::vector<MKLDNNNodePtr> &templateNodes) {
+        if (nodes.size() != templateNodes.size())
+            return false;
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (nodes[i]->getName() != templateNodes[i]->getName())
+                return false;
+        }
+        return true;
+    };
+    if (!sameEdges(parentEdges, templateNode->parentEdges) || !sameEdges(childEdges, templateNode->childEdges) ||
+        !sameNodes(fusedWith, templateNode->fusedWith) || !sameNodes(mergedWith, templateNode->mergedWith))
+        return nullptr;
+
+    return templateNode->prim.get();
+}
+
 void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
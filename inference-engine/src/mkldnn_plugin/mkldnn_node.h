@@ -576,6 +576,23 @@ protected:
     std::unordered_map<int, mkldnn::memory> primArgs;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
+    // node with the same name of the template graph, set only while the primitive is created
+    MKLDNNNodePtr templateNode;
+
+    /**
+     * @brief Takes the primitive of the template node if it was created for the same descriptor,
+     * otherwise creates a new one. The primitive gets memory on execution, so graphs of different
+     * streams can execute it concurrently.
+     */
+    template <typename PRIM, typename PD>
+    void createOrSharePrimitive(const PD &primitiveDesc) {
+        if (auto shared = getTemplatePrimitive()) {
+            prim = shared;
+            return;
+        }
+        prim.reset(new PRIM(primitiveDesc));
+    }
+    std::shared_ptr<mkldnn::primitive> getTemplatePrimitive() const;
 
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
@@ -7,10 +7,12 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
+#include <fstream>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
@@ -65,6 +67,7 @@
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/graph_util.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -95,13 +98,24 @@ Engine::Engine() {
 Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
+    ExecutorManager::getInstance()->clear("CPUSharedStreamsExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
-    auto nGraphFunc = clonedNetwork.getFunction();
-    // Disable shape inference (WA for generic operations)
-    ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
+// Precisions which are not supported by the plugin and the precisions they are converted to
+static std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> ConvertPrecisionList() {
+    return {
+            {ngraph::element::i64,     ngraph::element::i32},
+            {ngraph::element::u64,     ngraph::element::i32},
+            {ngraph::element::i16,     ngraph::element::i32},
+            {ngraph::element::u16,     ngraph::element::i32},
+            {ngraph::element::u32,     ngraph::element::i32},
+            {ngraph::element::f16,     ngraph::element::f32},
+            {ngraph::element::boolean, ngraph::element::u8},
+    };
+}
 
+// Transformations which keep the function in the opsets readable from IR, so the result of them is exported
+static void CommonTransformation(const std::shared_ptr<ngraph::Function>& nGraphFunc) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
@@ -120,17 +134,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::GRUCellDecomposition>();
     manager.register_pass<ngraph::pass::RNNCellDecomposition>();
 
-    std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
-            {ngraph::element::i64,     ngraph::element::i32},
-            {ngraph::element::u64,     ngraph::element::i32},
-            {ngraph::element::i16,     ngraph::element::i32},
-            {ngraph::element::u16,     ngraph::element::i32},
-            {ngraph::element::u32,     ngraph::element::i32},
-            {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-    };
-
-    for (auto &precision : convert_precision_list) {
+    for (auto &precision : ConvertPrecisionList()) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
@@ -211,7 +215,25 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     pass_config->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
 
     manager.run_passes(nGraphFunc);
+}
 
+/**
+ * @brief Converts the network function to the legacy representation the graph is created from
+ * @param commonTransformed true if CommonTransformation was already applied to the function, e.g. it was imported
+ * @param onCommonTransformed is called with the function after CommonTransformation
+ */
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf, bool commonTransformed = false,
+                           const std::function<void(const std::shared_ptr<ngraph::Function>&)>& onCommonTransformed = {}) {
+    auto nGraphFunc = clonedNetwork.getFunction();
+    // Disable shape inference (WA for generic operations)
+    ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
+
+    if (!commonTransformed)
+        CommonTransformation(nGraphFunc);
+    if (onCommonTransformed)
+        onCommonTransformed(nGraphFunc);
+
+    using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
     using namespace ngraph::pass::low_precision;
     if (conf.lpTransformsMode == Config::LPTransformsMode::On) {
         auto params = LayerTransformation::Params(
@@ -275,17 +297,52 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     // WA: after conversion to CNNNetwork user precision can redefine input/output precisions
     // so we need to apply additional precision conversion but only for inputs and outputs
-    for (auto & precision : convert_precision_list) {
+    for (auto & precision : ConvertPrecisionList()) {
         NetPass::ConvertIOPrecision(clonedNetwork,
             InferenceEngine::details::convertPrecision(precision.first),
             InferenceEngine::details::convertPrecision(precision.second));
     }
 }
 
+// Converts the network to the form MKLDNNGraph is created from, the arguments are passed to Transformation
+static void ConvertNetwork(CNNNetwork& clonedNetwork, const Config& conf, bool commonTransformed = false,
+                           const std::function<void(const std::shared_ptr<ngraph::Function>&)>& onCommonTransformed = {}) {
+    bool is_transformed = false;
+    if (clonedNetwork.getFunction()) {
+        Transformation(clonedNetwork, conf, commonTransformed, onCommonTransformed);
+        is_transformed = true;
+    }
+    IE_SUPPRESS_DEPRECATED_START
+    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
+    IE_SUPPRESS_DEPRECATED_END
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
+        }
+    }
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
+    return CompileNetwork(network, config, false);
+}
 
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::CompileNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                       bool commonTransformed) {
     // verification of supported input
     InferenceEngine::InputsDataMap _networkInputs = network.getInputsInfo();
     for (const auto &ii : _networkInputs) {
@@ -315,35 +372,115 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    if (conf.dynamicShapes) {
+        if (conf.enableDynamicBatch)
+            THROW_IE_EXCEPTION << "Dynamic batch and dynamic shapes cannot be enabled simultaneously";
+        if (!network.getFunction())
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Dynamic shapes are supported only for networks represented by ngraph::Function";
+        // shapes of the transformed function are folded into its constants, so it cannot be reshaped
+        if (commonTransformed)
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Dynamic shapes are not supported for the network exported after transformations";
+    }
+
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
 
-    bool is_transformed = false;
-    if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
+    // A copy of the network function is kept for Export only if export is requested or the network can be cached.
+    // The copy is taken after the common transformations, so they are not repeated on import. The untouched
+    // network is exported if the transformed one has operations which cannot be read from IR, or in dynamic shapes
+    // mode, as the transformed one cannot be reshaped.
+    // Constants data is shared between the copies.
+    std::shared_ptr<ngraph::Function> exportFunction;
+    bool exportTransformed = false;
+    if ((conf.exportable || !conf.cacheDir.empty()) && network.getFunction()) {
+        exportFunction = ngraph::clone_function(*network.getFunction());
+        exportTransformed = commonTransformed;
     }
-    IE_SUPPRESS_DEPRECATED_START
-    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
-    IE_SUPPRESS_DEPRECATED_END
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
+
+    ConvertNetwork(clonedNetwork, conf, commonTransformed, [&] (const std::shared_ptr<ngraph::Function> &function) {
+        if (exportFunction && !exportTransformed && !conf.dynamicShapes && isSerializable(function, extensionManager)) {
+            exportFunction = ngraph::clone_function(*function);
+            exportTransformed = true;
         }
+    });
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    execNetwork->setExportData(exportFunction, exportTransformed, config);
+
+    if (conf.dynamicShapes) {
+        // Input information of the original network is kept by the copies reshaped for the new dimensions
+        auto dynamicNetwork = InferenceEngine::cloneNetwork(network);
+        execNetwork->setDynamicShapesBuilder([dynamicNetwork, conf, commonTransformed] (const ICNNNetwork::InputShapes &shapes) {
+            auto reshapedNetwork = InferenceEngine::cloneNetwork(dynamicNetwork);
+            reshapedNetwork.reshape(shapes);
+            ConvertNetwork(reshapedNetwork, conf, commonTransformed);
+            return reshapedNetwork;
+        });
+        // Dimensions of data are inferred on the original function, the compiled network is matched with it by names
+        auto dynamicFunction = dynamicNetwork.getFunction();
+        execNetwork->setDynamicShapesInference([dynamicFunction] (const ICNNNetwork::InputShapes &shapes) {
+            auto function = ngraph::clone_function(*dynamicFunction);
+            for (const auto &parameter : function->get_parameters()) {
+                auto shape = shapes.find(parameter->get_friendly_name());
+                if (shape != shapes.end())
+                    parameter->set_partial_shape(ngraph::Shape(shape->second));
+            }
+            function->validate_nodes_and_infer_types();
+
+            std::map<std::string, SizeVector> dims;
+            for (const auto &node : function->get_ordered_ops()) {
+                if (ngraph::op::is_output(node))
+                    continue;
+                for (const auto &output : node->outputs()) {
+                    auto name = output.get_tensor().get_name();
+                    if (name.empty())
+                        name = ngraph::op::util::create_ie_output_name(output);
+                    dims[name] = output.get_shape();
+                }
+            }
+            return dims;
+        });
+    }
+    return execNetwork;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream &networkModel, const std::map<std::string, std::string> &config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    std::map<std::string, std::string> importConfig;
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string &model, const Blob::CPtr &weights) {
+            return GetCore()->ReadNetwork(model, weights);
+        });
+    bool transformed = false;
+    auto network = deserializer.deserialize(importConfig, transformed);
+
+    // configuration passed to ImportNetwork overrides one the network was exported with
+    for (const auto &item : config) {
+        importConfig[item.first] = item.second;
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    // the same as InferencePluginInternal::LoadNetwork, but the common transformations are skipped
+    // for the network exported after them
+    InputsDataMap networkInputs = network.getInputsInfo(), networkInputsCloned;
+    OutputsDataMap networkOutputs = network.getOutputsInfo(), networkOutputsCloned;
+    copyInputOutputInfo(networkInputs, networkOutputs, networkInputsCloned, networkOutputsCloned);
+
+    auto impl = CompileNetwork(network, importConfig, transformed);
+    impl->setNetworkInputs(networkInputsCloned);
+    impl->setNetworkOutputs(networkOutputsCloned);
+    impl->SetPointerToPlugin(shared_from_this());
+
+    return ExecutableNetwork(make_executable_network(impl));
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) {
+    std::ifstream modelFile(modelFileName, std::ios::binary);
+    if (!modelFile.is_open())
+        THROW_IE_EXCEPTION << "Cannot open exported network file " << modelFileName;
+
+    return InferencePluginInternal::ImportNetwork(modelFile, config);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -386,6 +523,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -432,6 +570,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
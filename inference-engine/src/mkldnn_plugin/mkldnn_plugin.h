@@ -25,6 +25,16 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork
+    ImportNetworkImpl(std::istream &networkModel,
+                      const std::map<std::string, std::string> &config) override;
+
+    InferenceEngine::ExecutableNetwork
+    ImportNetwork(const std::string &modelFileName,
+                  const std::map<std::string, std::string> &config) override;
+
+    using InferenceEngine::InferencePluginInternal::ImportNetwork;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -37,6 +47,11 @@ public:
                                                      const std::map<std::string, std::string>& config) const override;
 
 private:
+    // commonTransformed is true for imported networks, which are exported after the common transformations
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    CompileNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                   bool commonTransformed);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
@@ -21,6 +21,10 @@ void MKLDNNPrimitive::reset(mkldnn::primitive* primitive) {
     prim.reset(primitive);
 }
 
+const std::shared_ptr<mkldnn::primitive>& MKLDNNPrimitive::get() const {
+    return prim;
+}
+
 MKLDNNPrimitive &MKLDNNPrimitive::operator=(const std::shared_ptr<mkldnn::primitive>& primitive) {
     prim = primitive;
     return *this;
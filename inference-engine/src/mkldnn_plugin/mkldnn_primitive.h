@@ -21,6 +21,7 @@ public:
     mkldnn::primitive operator*();
 
     void reset(mkldnn::primitive* primitive);
+    const std::shared_ptr<mkldnn::primitive>& get() const;
 
 private:
     std::shared_ptr<mkldnn::primitive> prim;
@@ -0,0 +1,270 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <blob_factory.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include <ie_common.h>
+#include <transformations/serialize.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Should be incremented on every change of the stream layout
+constexpr std::uint32_t exportFormatVersion = 1;
+
+template <typename T>
+void write(std::ostream &stream, const T &value) {
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void writeString(std::ostream &stream, const std::string &str) {
+    write(stream, static_cast<std::uint64_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+template <typename T>
+T read(std::istream &stream) {
+    T value {};
+    stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+    if (!stream.good())
+        THROW_IE_EXCEPTION << "Unexpected end of the CPU executable network stream";
+    return value;
+}
+
+// Reads the number of following elements of the given size. The number is checked against the rest of
+// the stream, so a corrupted stream does not cause huge allocations. The check is skipped for the streams
+// which do not support seeking.
+std::uint64_t readSize(std::istream &stream, std::uint64_t elementSize) {
+    auto size = read<std::uint64_t>(stream);
+    auto pos = stream.tellg();
+    if (pos == std::istream::pos_type(-1))
+        return size;
+    stream.seekg(0, std::ios::end);
+    auto end = stream.tellg();
+    stream.seekg(pos);
+    if (end == std::istream::pos_type(-1) || !stream.good())
+        THROW_IE_EXCEPTION << "Failed to read the CPU executable network stream";
+    if (size > static_cast<std::uint64_t>(end - pos) / elementSize)
+        THROW_IE_EXCEPTION << "Corrupted CPU executable network stream: size " << size << " exceeds the stream length";
+    return size;
+}
+
+std::string readString(std::istream &stream) {
+    std::string str(readSize(stream, 1), '\0');
+    stream.read(&str[0], str.size());
+    if (!stream.good())
+        THROW_IE_EXCEPTION << "Unexpected end of the CPU executable network stream";
+    return str;
+}
+
+void writeBlob(std::ostream &stream, const Blob::Ptr &blob) {
+    const auto &desc = blob->getTensorDesc();
+    write(stream, static_cast<std::int32_t>(desc.getPrecision()));
+    write(stream, static_cast<std::uint64_t>(desc.getDims().size()));
+    for (auto dim : desc.getDims())
+        write(stream, static_cast<std::uint64_t>(dim));
+    write(stream, static_cast<std::uint64_t>(blob->byteSize()));
+    stream.write(blob->cbuffer().as<const char *>(), blob->byteSize());
+}
+
+Blob::Ptr readBlob(std::istream &stream) {
+    auto precision = static_cast<Precision::ePrecision>(read<std::int32_t>(stream));
+    SizeVector dims(readSize(stream, sizeof(std::uint64_t)));
+    for (auto &dim : dims)
+        dim = read<std::uint64_t>(stream);
+
+    // the memory is allocated only after the size is checked
+    auto blob = make_blob_with_precision(TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims)));
+    auto byteSize = readSize(stream, 1);
+    if (byteSize != blob->byteSize())
+        THROW_IE_EXCEPTION << "Corrupted CPU executable network stream: blob size mismatch";
+    blob->allocate();
+    stream.read(blob->buffer().as<char *>(), byteSize);
+    if (!stream.good())
+        THROW_IE_EXCEPTION << "Unexpected end of the CPU executable network stream";
+    return blob;
+}
+
+}  // namespace
+
+bool isSerializable(const std::shared_ptr<ngraph::Function> &function, const MKLDNNExtensionManager::Ptr &extensionManager) {
+    const auto extensionOpsets = extensionManager->GetOpSets();
+    std::vector<const ngraph::OpSet *> opsets{&ngraph::get_opset1(), &ngraph::get_opset2(), &ngraph::get_opset3(),
+                                              &ngraph::get_opset4(), &ngraph::get_opset5(), &ngraph::get_opset6()};
+    for (const auto &opset : extensionOpsets) {
+        opsets.push_back(&opset.second);
+    }
+
+    std::function<bool(const std::shared_ptr<ngraph::Function> &)> check = [&](const std::shared_ptr<ngraph::Function> &f) {
+        for (const auto &node : f->get_ops()) {
+            if (std::none_of(opsets.begin(), opsets.end(), [&](const ngraph::OpSet *opset) {
+                    return opset->contains_op_type(node.get());
+                }))
+                return false;
+            auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node);
+            if (subGraph && !check(subGraph->get_function()))
+                return false;
+        }
+        return true;
+    };
+    return check(function);
+}
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream &ostream, const MKLDNNExtensionManager::Ptr &extensionManager)
+    : _ostream(ostream), _extensionManager(extensionManager) {}
+
+void CNNNetworkSerializer::serialize(const std::shared_ptr<ngraph::Function> &function,
+                                     bool transformed,
+                                     const InputsDataMap &inputs,
+                                     const OutputsDataMap &outputs,
+                                     const std::map<std::string, std::string> &config) {
+    if (!function)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "CPU plugin can export only networks represented by ngraph::Function";
+
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10,
+                                       _extensionManager->GetOpSets());
+    serializer.run_on_function(function);
+
+    write(_ostream, exportFormatVersion);
+    write(_ostream, static_cast<std::uint8_t>(transformed));
+
+    write(_ostream, static_cast<std::uint64_t>(config.size()));
+    for (const auto &item : config) {
+        writeString(_ostream, item.first);
+        writeString(_ostream, item.second);
+    }
+
+    write(_ostream, static_cast<std::uint64_t>(inputs.size()));
+    for (const auto &input : inputs) {
+        const auto &preProcess = input.second->getPreProcess();
+        writeString(_ostream, input.first);
+        write(_ostream, static_cast<std::int32_t>(input.second->getPrecision()));
+        write(_ostream, static_cast<std::int32_t>(input.second->getLayout()));
+        write(_ostream, static_cast<std::int32_t>(preProcess.getResizeAlgorithm()));
+        write(_ostream, static_cast<std::int32_t>(preProcess.getColorFormat()));
+        write(_ostream, static_cast<std::int32_t>(preProcess.getMeanVariant()));
+        write(_ostream, static_cast<std::uint8_t>(preProcess.getFusedNormalization()));
+        write(_ostream, static_cast<std::uint64_t>(preProcess.getNumberOfChannels()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            const auto &channel = preProcess[c];
+            write(_ostream, channel->stdScale);
+            write(_ostream, channel->meanValue);
+            write(_ostream, static_cast<std::uint8_t>(channel->meanData != nullptr));
+            if (channel->meanData)
+                writeBlob(_ostream, channel->meanData);
+        }
+    }
+
+    write(_ostream, static_cast<std::uint64_t>(outputs.size()));
+    for (const auto &output : outputs) {
+        writeString(_ostream, output.first);
+        write(_ostream, static_cast<std::int32_t>(output.second->getPrecision()));
+        write(_ostream, static_cast<std::int32_t>(output.second->getLayout()));
+    }
+
+    writeString(_ostream, xmlFile.str());
+    writeString(_ostream, binFile.str());
+
+    if (!_ostream.good())
+        THROW_IE_EXCEPTION << "Failed to write CPU executable network to the stream";
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream &istream, CNNNetworkBuilder builder)
+    : _istream(istream), _builder(std::move(builder)) {}
+
+CNNNetwork CNNNetworkDeserializer::deserialize(std::map<std::string, std::string> &config, bool &transformed) {
+    auto version = read<std::uint32_t>(_istream);
+    if (version != exportFormatVersion)
+        THROW_IE_EXCEPTION << "Unsupported version of the CPU executable network stream: " << version
+                           << ". Expected: " << exportFormatVersion;
+    transformed = read<std::uint8_t>(_istream) != 0;
+
+    // every item takes at least the sizes of its strings
+    auto configSize = readSize(_istream, 2 * sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < configSize; i++) {
+        auto key = readString(_istream);
+        config[key] = readString(_istream);
+    }
+
+    struct InputData {
+        Precision precision;
+        Layout layout;
+        PreProcessInfo preProcess;
+    };
+    std::map<std::string, InputData> inputs;
+    auto inputsSize = readSize(_istream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < inputsSize; i++) {
+        auto name = readString(_istream);
+        auto &input = inputs[name];
+        input.precision = static_cast<Precision::ePrecision>(read<std::int32_t>(_istream));
+        input.layout = static_cast<Layout>(read<std::int32_t>(_istream));
+        input.preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(read<std::int32_t>(_istream)));
+        input.preProcess.setColorFormat(static_cast<ColorFormat>(read<std::int32_t>(_istream)));
+        auto meanVariant = static_cast<MeanVariant>(read<std::int32_t>(_istream));
+        input.preProcess.setFusedNormalization(read<std::uint8_t>(_istream) != 0);
+        input.preProcess.init(readSize(_istream, 2 * sizeof(float)));
+        for (size_t c = 0; c < input.preProcess.getNumberOfChannels(); c++) {
+            auto &channel = input.preProcess[c];
+            channel->stdScale = read<float>(_istream);
+            channel->meanValue = read<float>(_istream);
+            if (read<std::uint8_t>(_istream))
+                channel->meanData = readBlob(_istream);
+        }
+        input.preProcess.setVariant(meanVariant);
+    }
+
+    std::map<std::string, std::pair<Precision, Layout>> outputs;
+    auto outputsSize = readSize(_istream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < outputsSize; i++) {
+        auto name = readString(_istream);
+        auto precision = static_cast<Precision::ePrecision>(read<std::int32_t>(_istream));
+        auto layout = static_cast<Layout>(read<std::int32_t>(_istream));
+        outputs[name] = {precision, layout};
+    }
+
+    auto model = readString(_istream);
+    auto weightsSize = readSize(_istream, 1);
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C});
+    weights->allocate();
+    _istream.read(weights->buffer().as<char *>(), weightsSize);
+    if (!_istream.good())
+        THROW_IE_EXCEPTION << "Unexpected end of the CPU executable network stream";
+
+    auto network = _builder(model, weights);
+
+    for (auto &input : network.getInputsInfo()) {
+        auto it = inputs.find(input.first);
+        if (it == inputs.end())
+            THROW_IE_EXCEPTION << "Corrupted CPU executable network stream: no information for input " << input.first;
+        input.second->setPrecision(it->second.precision);
+        input.second->setLayout(it->second.layout);
+        input.second->getPreProcess() = it->second.preProcess;
+    }
+    for (auto &output : network.getOutputsInfo()) {
+        auto it = outputs.find(output.first);
+        if (it == outputs.end())
+            THROW_IE_EXCEPTION << "Corrupted CPU executable network stream: no information for output " << output.first;
+        output.second->setPrecision(it->second.first);
+        output.second->setLayout(it->second.second);
+    }
+
+    return network;
+}
+
+}  // namespace MKLDNNPlugin
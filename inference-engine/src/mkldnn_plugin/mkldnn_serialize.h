@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include "mkldnn_extension_mngr.h"
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Checks that operations of the function belong to the standard opsets or to the extensions opsets,
+ * so the function written by CNNNetworkSerializer is read back
+ */
+bool isSerializable(const std::shared_ptr<ngraph::Function> &function, const MKLDNNExtensionManager::Ptr &extensionManager);
+
+/**
+ * @brief Writes network to the export stream of the CPU executable network.
+ * The stream contains IR v10 of the network, its inputs and outputs information
+ * (precisions, layouts and preprocessing) and the configuration used for the network load.
+ * The network is written after the plugin transformations which keep it in the IR opsets if they were applied.
+ * The compiled graph is not written: import repeats the rest of the transformations, graph fusions,
+ * primitive descriptors selection and weights reorders.
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream &ostream, const MKLDNNExtensionManager::Ptr &extensionManager);
+
+    void serialize(const std::shared_ptr<ngraph::Function> &function,
+                   bool transformed,
+                   const InferenceEngine::InputsDataMap &inputs,
+                   const InferenceEngine::OutputsDataMap &outputs,
+                   const std::map<std::string, std::string> &config);
+
+private:
+    std::ostream &_ostream;
+    MKLDNNExtensionManager::Ptr _extensionManager;
+};
+
+/**
+ * @brief Restores network written by CNNNetworkSerializer.
+ * IR is converted to CNNNetwork with the builder function, which is usually ICore::ReadNetwork.
+ */
+class CNNNetworkDeserializer {
+public:
+    using CNNNetworkBuilder = std::function<InferenceEngine::CNNNetwork(const std::string &, const InferenceEngine::Blob::CPtr &)>;
+
+    CNNNetworkDeserializer(std::istream &istream, CNNNetworkBuilder builder);
+
+    InferenceEngine::CNNNetwork deserialize(std::map<std::string, std::string> &config, bool &transformed);
+
+private:
+    std::istream &_istream;
+    CNNNetworkBuilder _builder;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,14 +3,62 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_weights_hash_imp.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    constexpr size_t chunkSize = 1 << 20;
+    const size_t chunks = (size + chunkSize - 1) / chunkSize;
+    if (chunks <= 1)
+        return XARCH::weights_hash(data, size);
+
+    std::vector<uint64_t> chunkHashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        chunkHashes[i] = XARCH::weights_hash(data + offset, std::min(chunkSize, size - offset));
+    });
+    return XARCH::weights_hash(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                               chunkHashes.size() * sizeof(uint64_t));
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& name_hash,
+                                                   std::function<MKLDNNMemoryPtr(void)> create) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[name_hash];
+        if (!found)
+            found = std::make_shared<Entry>();
+        entry = found;
+    }
+
+    std::lock_guard<std::mutex> lock(entry->guard);
+    MKLDNNMemoryPtr ptr = entry->memory.lock();
+    if (ptr) {
+        hits++;
+        bytesSaved += ptr->GetSize();
+    } else {
+        ptr = create();
+        entry->memory = ptr;
+        misses++;
+        bytes += ptr->GetSize();
+    }
+    return ptr;
+}
+
+MKLDNNWeightsSharing::Statistics MKLDNNWeightsSharing::GetStatistics() const {
+    return {hits.load(), misses.load(), bytes.load(), bytesSaved.load()};
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -30,4 +78,11 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+std::map<int, MKLDNNWeightsSharing::Statistics> NumaNodesWeights::GetStatistics() const {
+    std::map<int, MKLDNNWeightsSharing::Statistics> statistics;
+    for (const auto& cache : _cache_map)
+        statistics[cache.first] = cache.second->GetStatistics();
+    return statistics;
+}
+
 }  // namespace MKLDNNPlugin
@@ -7,6 +7,8 @@
 #include <mkldnn_memory.h>
 
 #include <unordered_map>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <memory>
@@ -23,54 +25,51 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    /**
+     * Computes 64-bit hash of the data. Large blocks are split into fixed size chunks which are
+     * hashed in parallel, so the result does not depend on the number of threads.
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
 };
 
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
- * Is a thread safe
+ * Is a thread safe. The global lock is held only to find the entry of the key, objects are
+ * created under the lock of their own entry, so threads creating different weights do not
+ * wait for each other and threads requesting the same weights wait only for its creation.
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    struct Statistics {
+        uint64_t hits;          // number of requests served from the cache
+        uint64_t misses;        // number of created objects
+        uint64_t bytes;         // size of created objects
+        uint64_t bytesSaved;    // size of objects served from the cache instead of being created
+    };
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
-                             std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
-
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
-            sharedWeights[name_hash] = ptr;
-        }
-        return ptr;
-    }
+                             std::function<MKLDNNMemoryPtr(void)> create);
+
+    Statistics GetStatistics() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    struct Entry {
+        std::mutex guard;
+        std::weak_ptr<MKLDNNMemory> memory;
+    };
+
+    std::unordered_map<std::string, std::shared_ptr<Entry>> sharedWeights;
     std::mutex guard;
+    std::atomic<uint64_t> hits = {0};
+    std::atomic<uint64_t> misses = {0};
+    std::atomic<uint64_t> bytes = {0};
+    std::atomic<uint64_t> bytesSaved = {0};
     static const SimpleDataHash simpleCRC;
 };
 
@@ -86,6 +85,8 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    std::map<int, MKLDNNWeightsSharing::Statistics> GetStatistics() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_weights_hash_imp.hpp"
+
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <nmmintrin.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace XARCH {
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+
+inline uint64_t load64(const unsigned char* ptr) {
+    uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline uint64_t rotl(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Final avalanche of MurmurHash3
+inline uint64_t fmix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+}  // namespace
+
+#if (defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)) && (defined(__x86_64__) || defined(_M_X64))
+
+uint64_t weights_hash(const unsigned char* data, size_t size) {
+    // Independent lanes hide latency of the crc32 instruction
+    uint64_t c0 = 0, c1 = prime1, c2 = prime2, c3 = ~0ULL;
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        c0 = _mm_crc32_u64(c0, load64(data + i));
+        c1 = _mm_crc32_u64(c1, load64(data + i + 8));
+        c2 = _mm_crc32_u64(c2, load64(data + i + 16));
+        c3 = _mm_crc32_u64(c3, load64(data + i + 24));
+    }
+    for (; i + 8 <= size; i += 8)
+        c0 = _mm_crc32_u64(c0, load64(data + i));
+    for (; i < size; i++)
+        c1 = _mm_crc32_u8(static_cast<uint32_t>(c1), data[i]);
+
+    const uint64_t h = (c0 | (c1 << 32)) ^ rotl((c2 | (c3 << 32)) * prime1, 29);
+    return fmix(h ^ static_cast<uint64_t>(size));
+}
+
+#else
+
+uint64_t weights_hash(const unsigned char* data, size_t size) {
+    auto round = [](uint64_t acc, uint64_t value) {
+        return rotl(acc + value * prime2, 31) * prime1;
+    };
+
+    uint64_t v0 = prime1 + prime2, v1 = prime2, v2 = 0, v3 = 0 - prime1;
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        v0 = round(v0, load64(data + i));
+        v1 = round(v1, load64(data + i + 8));
+        v2 = round(v2, load64(data + i + 16));
+        v3 = round(v3, load64(data + i + 24));
+    }
+    uint64_t h = rotl(v0, 1) + rotl(v1, 7) + rotl(v2, 12) + rotl(v3, 18);
+    for (; i + 8 <= size; i += 8)
+        h = rotl(h ^ round(0, load64(data + i)), 27) * prime1 + prime2;
+    for (; i < size; i++)
+        h = rotl(h ^ (data[i] * prime2), 11) * prime1;
+
+    return fmix(h ^ static_cast<uint64_t>(size));
+}
+
+#endif
+
+}  // namespace XARCH
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+namespace XARCH {
+
+/**
+ * Computes 64-bit hash of the data block. SSE4.2 version is based on hardware CRC32C instruction
+ * applied to 4 interleaved lanes, generic version uses 64-bit multiplicative mixing of 4 lanes.
+ * Different ISA versions produce different values, so hashes can be compared only within the process.
+ */
+uint64_t weights_hash(const unsigned char* data, size_t size);
+
+}  // namespace XARCH
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "ie_parallel.hpp"
+#include "nodes/nms_imp.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct NmsCandidate {
+    float score;
+    int index;
+};
+
+// descending score and ascending index on ties, the full order keeps results deterministic
+static inline bool nms_candidate_greater(const NmsCandidate& l, const NmsCandidate& r) {
+    return l.score > r.score || (l.score == r.score && l.index < r.index);
+}
+
+/**
+ * Scratch buffers of one thread running NMS tasks. They are sized for the largest task once,
+ * so selection of boxes does not allocate.
+ */
+struct NmsWorkspace {
+    void reserve(int max_boxes) {
+        if (capacity >= max_boxes)
+            return;
+        capacity = max_boxes;
+        stride = nms_padded_size(max_boxes);
+        candidates.reserve(capacity);
+        boxes.resize(nms_box_planes * stride);
+        kept.resize(nms_box_planes * stride);
+        selected.resize(capacity);
+    }
+
+    int capacity = 0;
+    int stride = 0;
+    std::vector<NmsCandidate> candidates;
+    std::vector<float> boxes;
+    std::vector<float> kept;
+    std::vector<int> selected;
+};
+
+/**
+ * Workspaces of the threads which run NMS tasks over batches and classes in parallel.
+ */
+class NmsWorkspaces {
+public:
+    void prepare(int max_boxes) {
+        const size_t threads = static_cast<size_t>(parallel_get_max_threads());
+        if (workspaces.size() < threads)
+            workspaces.resize(threads);
+        for (auto& workspace : workspaces)
+            workspace.reserve(max_boxes);
+    }
+
+    NmsWorkspace& local() {
+        return workspaces[parallel_get_thread_num()];
+    }
+
+private:
+    std::vector<NmsWorkspace> workspaces;
+};
+
+/**
+ * Greedy hard NMS over workspace.candidates.
+ * Only top_k best candidates take part in the selection (all of them if top_k < 0); they are not sorted
+ * as a whole but in chunks growing from twice the expected output size, so the sort stops as soon as
+ * max_output_boxes are kept. get_box(index, xmin, ymin, xmax, ymax) returns corners of the candidate box.
+ * Returns the number of kept boxes, workspace.selected holds positions of their candidates in selection order.
+ */
+template <typename GetBox>
+int nms_hard(NmsWorkspace& workspace, int top_k, const nms_conf& conf, const GetBox& get_box) {
+    static constexpr int min_sorted_chunk = 64;
+
+    auto candidates = workspace.candidates.begin();
+    int count = static_cast<int>(workspace.candidates.size());
+    if (top_k >= 0 && top_k < count) {
+        std::nth_element(candidates, candidates + top_k, candidates + count, nms_candidate_greater);
+        count = top_k;
+    }
+
+    const int stride = workspace.stride;
+    float* xmin = workspace.boxes.data();
+    float* ymin = xmin + stride;
+    float* xmax = xmin + 2 * stride;
+    float* ymax = xmin + 3 * stride;
+    float* area = xmin + 4 * stride;
+
+    const int max_output = (std::min)(conf.max_output_boxes, count);
+    int chunk = max_output < count ? (std::max)(2 * max_output, min_sorted_chunk) : count;
+    int num_kept = 0;
+    for (int first = 0; first < count && num_kept < max_output; first += chunk, chunk = (std::min)(2 * chunk, count)) {
+        const int last = (std::min)(first + chunk, count);
+        if (last < count)
+            std::nth_element(candidates + first, candidates + last, candidates + count, nms_candidate_greater);
+        std::sort(candidates + first, candidates + last, nms_candidate_greater);
+
+        for (int i = first; i < last; i++) {
+            get_box(candidates[i].index, xmin[i], ymin[i], xmax[i], ymax[i]);
+            area[i] = (xmax[i] - xmin[i]) * (ymax[i] - ymin[i]);
+        }
+
+        const int kept_before = num_kept;
+        num_kept = XARCH::nms_hard_select(xmin + first, last - first, stride, conf,
+                                          workspace.kept.data(), stride, num_kept, workspace.selected.data());
+        for (int k = kept_before; k < num_kept; k++)
+            workspace.selected[k] += first;
+    }
+    return num_kept;
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -19,7 +20,7 @@ namespace Cpu {
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -80,12 +81,6 @@ public:
             _decoded_bboxes = InferenceEngine::make_shared_blob<float>({Precision::FP32, bboxes_size, NCHW});
             _decoded_bboxes->allocate();
 
-            InferenceEngine::SizeVector buf_size{static_cast<size_t>(_num),
-                                                 static_cast<size_t>(_num_classes),
-                                                 static_cast<size_t>(_num_priors)};
-            _buffer = InferenceEngine::make_shared_blob<int>({Precision::I32, buf_size, {buf_size, {0, 1, 2}}});
-            _buffer->allocate();
-
             InferenceEngine::SizeVector indices_size{static_cast<size_t>(_num),
                                                      static_cast<size_t>(_num_classes),
                                                      static_cast<size_t>(_num_priors)};
@@ -101,12 +96,7 @@ public:
             _reordered_conf = InferenceEngine::make_shared_blob<float>({Precision::FP32, conf_size, ANY});
             _reordered_conf->allocate();
 
-            InferenceEngine::SizeVector decoded_bboxes_size{static_cast<size_t>(_num),
-                                                            static_cast<size_t>(_num_priors),
-                                                            static_cast<size_t>(_num_classes)};
-            _bbox_sizes = InferenceEngine::make_shared_blob<float>(
-                    {Precision::FP32, decoded_bboxes_size, {decoded_bboxes_size, {0, 1, 2}}});
-            _bbox_sizes->allocate();
+            _mx_candidates.reserve(_num_priors);
 
             InferenceEngine::SizeVector num_priors_actual_size{static_cast<size_t>(_num)};
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
@@ -133,9 +123,7 @@ public:
 
         float *decoded_bboxes_data = _decoded_bboxes->buffer().as<float *>();
         float *reordered_conf_data = _reordered_conf->buffer().as<float *>();
-        float *bbox_sizes_data     = _bbox_sizes->buffer().as<float *>();
         int *detections_data       = _detections_count->buffer().as<int *>();
-        int *buffer_data           = _buffer->buffer().as<int *>();
         int *indices_data          = _indices->buffer().as<int *>();
         int *num_priors_actual     = _num_priors_actual->buffer().as<int *>();
 
@@ -150,14 +138,13 @@ public:
             if (_share_location) {
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
-                float *psizes = bbox_sizes_data + n*_num_priors;
 
                 if (with_add_box_pred) {
                     const float *p_arm_loc = arm_loc_data + n*4*_num_priors;
-                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, num_priors_actual, n, 0, 4, false);
                 } else {
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
                 }
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
@@ -166,13 +153,12 @@ public:
                     }
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
-                    float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
                     if (with_add_box_pred) {
                         const float *p_arm_loc = arm_loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
+                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, num_priors_actual, n, 0, 4, false);
                     } else {
-                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
                     }
                 }
             }
@@ -204,42 +190,39 @@ public:
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
+        _workspaces.prepare(_num_priors);
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                    }
+
+                    nms_cf(pconf, pboxes, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        }
+
         for (int n = 0; n < N; ++n) {
             int detections_total = 0;
 
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
-                    }
-                });
-            } else {
+            if (_decrease_label_id) {
                 // MXNet style
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
                 const float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors;
-                const float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors;
 
-                nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
+                nms_mx(pconf, pboxes, pindices, pdetections, _num_priors);
             }
 
             for (int c = 0; c < _num_classes; ++c) {
@@ -261,8 +244,8 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k, conf_index_class_map.end(),
+                                  SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -387,78 +370,27 @@ private:
     };
 
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
+                      float *decoded_bboxes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true); // after ARM = false
 
-    void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+    void nms_cf(const float *conf_data, const float *bboxes, int *indices, int &detections, int num_priors_actual);
 
-    void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int *detections, int num_priors_actual);
+    void nms_mx(const float *conf_data, const float *bboxes, int *indices, int *detections, int num_priors_actual);
 
     InferenceEngine::Blob::Ptr _decoded_bboxes;
-    InferenceEngine::Blob::Ptr _buffer;
     InferenceEngine::Blob::Ptr _indices;
     InferenceEngine::Blob::Ptr _detections_count;
     InferenceEngine::Blob::Ptr _reordered_conf;
-    InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
-};
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* _conf_data;
+    NmsWorkspaces _workspaces;
+    std::vector<NmsCandidate> _mx_candidates;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
-
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        const float *loc_data,
                                        const float *variance_data,
                                        float *decoded_bboxes,
-                                       float *decoded_bbox_sizes,
                                        int* num_priors_actual,
                                        int n,
                                        const int& offs,
@@ -551,59 +483,44 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         decoded_bboxes[p*4 + 1] = new_ymin;
         decoded_bboxes[p*4 + 2] = new_xmax;
         decoded_bboxes[p*4 + 3] = new_ymax;
-
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
     });
 }
 
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
-                          const float* sizes,
-                          int* buffer,
                           int* indices,
                           int& detections,
                           int num_priors_actual) {
-    int count = 0;
+    NmsWorkspace &workspace = _workspaces.local();
+    workspace.candidates.clear();
     for (int i = 0; i < num_priors_actual; ++i) {
         if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
+            workspace.candidates.push_back({conf_data[i], i});
         }
     }
 
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    nms_conf conf;
+    conf.iou_threshold = _nms_threshold;
+    conf.suppress_equal = false;
+    conf.max_output_boxes = num_priors_actual;
 
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
+    detections = nms_hard(workspace, _top_k, conf, [&](int idx, float &xmin, float &ymin, float &xmax, float &ymax) {
+        xmin = bboxes[idx*4 + 0];
+        ymin = bboxes[idx*4 + 1];
+        xmax = bboxes[idx*4 + 2];
+        ymax = bboxes[idx*4 + 3];
+    });
+    for (int i = 0; i < detections; ++i) {
+        indices[i] = workspace.candidates[workspace.selected[i]].index;
     }
 }
 
 void DetectionOutputImpl::nms_mx(const float* conf_data,
                           const float* bboxes,
-                          const float* sizes,
-                          int* buffer,
                           int* indices,
                           int* detections,
                           int num_priors_actual) {
-    int count = 0;
+    _mx_candidates.clear();
     for (int i = 0; i < num_priors_actual; ++i) {
         float conf = -1;
         int id = 0;
@@ -616,42 +533,41 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         }
 
         if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+            _mx_candidates.push_back({conf, id*_num_priors + i});
         }
     }
 
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
-
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-        const int cls = idx/_num_priors;
-        const int prior = idx%_num_priors;
-
-        int &ndetection = detections[cls];
-        int *pindices = indices + cls*_num_priors;
-
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
+    const int count = static_cast<int>(_mx_candidates.size());
+    const int num_output_scores = (_top_k < 0 ? count : (std::min)(_top_k, count));
+    std::nth_element(_mx_candidates.begin(), _mx_candidates.begin() + num_output_scores, _mx_candidates.end(), nms_candidate_greater);
+
+    nms_conf conf;
+    conf.iou_threshold = _nms_threshold;
+    conf.suppress_equal = false;
+    conf.max_output_boxes = num_priors_actual;
+
+    // a box is compared only with kept boxes of its class, so the classes run independently
+    parallel_for(_num_classes, [&](int cls) {
+        NmsWorkspace &workspace = _workspaces.local();
+        workspace.candidates.clear();
+        for (int i = 0; i < num_output_scores; ++i) {
+            if (_mx_candidates[i].index / _num_priors == cls) {
+                workspace.candidates.push_back({_mx_candidates[i].score, _mx_candidates[i].index % _num_priors});
             }
         }
-        if (keep) {
-            pindices[ndetection++] = prior;
+
+        const float *pboxes = _share_location ? bboxes : bboxes + cls*4*_num_priors;
+        int *pindices = indices + cls*_num_priors;
+        detections[cls] = nms_hard(workspace, -1, conf, [&](int prior, float &xmin, float &ymin, float &xmax, float &ymax) {
+            xmin = pboxes[prior*4 + 0];
+            ymin = pboxes[prior*4 + 1];
+            xmax = pboxes[prior*4 + 2];
+            ymax = pboxes[prior*4 + 3];
+        });
+        for (int i = 0; i < detections[cls]; ++i) {
+            pindices[i] = workspace.candidates[workspace.selected[i]].index;
         }
-    }
+    });
 }
 
 REG_FACTORY_FOR(DetectionOutputImpl, DetectionOutput);
@@ -140,7 +140,7 @@ void MKLDNNBatchNormalizationNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<batch_normalization_forward::primitive_desc,
             batch_normalization_forward::desc>();
-    prim.reset(new batch_normalization_forward(prim_desc));
+    createOrSharePrimitive<batch_normalization_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -584,7 +584,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    createOrSharePrimitive<convolution_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
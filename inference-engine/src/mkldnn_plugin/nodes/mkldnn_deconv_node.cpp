@@ -194,7 +194,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
             convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-    prim.reset(new convolution_backward_data(prim_desc));
+    createOrSharePrimitive<convolution_backward_data>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
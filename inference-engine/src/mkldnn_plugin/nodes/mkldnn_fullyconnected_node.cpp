@@ -137,7 +137,7 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    createOrSharePrimitive<inner_product_forward>(*prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
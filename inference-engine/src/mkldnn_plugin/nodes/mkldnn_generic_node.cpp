@@ -7,7 +7,6 @@
 #include "mkldnn_generic_node.h"
 #include <vector>
 #include <string>
-#include <blob_factory.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -65,6 +64,7 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory || !impls.empty()) {
+        bindBlobs();
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -107,49 +107,36 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
+void MKLDNNGenericNode::bindBlobs() {
+    inputEdges.clear();
+    inputs.clear();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
-            isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
+        inputEdges.push_back(getParentEdgeAt(i));
+        inputs.push_back(inputEdges.back()->getBlob());
     }
 
-    if (isDynBatch) {
-        // TODO: use ngraph-based extension mechnism if needed to recompute shape
-        isDynBatch = false;
+    outputEdges.clear();
+    outputs.clear();
+    for (size_t i = 0; i < outDims.size(); i++) {
+        outputEdges.push_back(getChildEdgesAtPort(i)[0]);
+        outputs.push_back(outputEdges.back()->getBlob());
     }
+}
 
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
-    }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
-    for (size_t i = 0; i < outDims.size(); i++) {
-        if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
-            td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
-        }
+void MKLDNNGenericNode::updateBlobs(const std::vector<MKLDNNEdgePtr>& edges, std::vector<InferenceEngine::Blob::Ptr>& views) {
+    for (size_t i = 0; i < edges.size(); i++) {
+        // the memory of input and output edges may be re-pointed to user blobs between inferences
+        if (views[i]->cbuffer().as<const void*>() != edges[i]->getMemory().GetData())
+            views[i] = edges[i]->getBlob();
     }
+}
+
+void MKLDNNGenericNode::execLayer() {
+    if (inputEdges.size() != getParentEdges().size() || outputEdges.size() != outDims.size())
+        bindBlobs();
+    updateBlobs(inputEdges, inputs);
+    updateBlobs(outputEdges, outputs);
+
     InferenceEngine::ResponseDesc resp;
     InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
     if (rc != InferenceEngine::OK) {
@@ -40,6 +40,17 @@ protected:
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+private:
+    void bindBlobs();
+    static void updateBlobs(const std::vector<MKLDNNEdgePtr>& edges, std::vector<InferenceEngine::Blob::Ptr>& views);
+
+    // Blobs over the memory of the edges are created once and only re-created when the memory is re-pointed,
+    // so the execution of the layer doesn't allocate
+    std::vector<MKLDNNEdgePtr> inputEdges;
+    std::vector<MKLDNNEdgePtr> outputEdges;
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    std::vector<InferenceEngine::Blob::Ptr> outputs;
 };
 
 }  // namespace MKLDNNPlugin
@@ -52,7 +52,7 @@ void MKLDNNLrnNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<lrn_forward::primitive_desc, lrn_forward::desc>();
 
-    prim.reset(new lrn_forward(prim_desc));
+    createOrSharePrimitive<lrn_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -52,7 +52,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer),
+          internalStore(new MKLDNNMemory{eng}), dataStore(new MKLDNNMemory{eng}) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -62,10 +63,13 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
     auto mem_desc = getChildEdgeAt(0)->getMemoryPtr()->GetDescriptor();
-    dataStore->Create(mem_desc);
+    internalStore->Create(mem_desc);
 
     // default memory state is zero filled
-    dataStore->FillZero();
+    internalStore->FillZero();
+
+    // dataStore does not own the memory, so it can be rebound to the state of an infer request
+    dataStore->Create(mem_desc, internalStore->GetData());
 }
 
 /**
@@ -94,6 +98,10 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindState(void* data) {
+    dataStore->GetPrimitivePtr()->set_data_handle_no_pads_proc(data != nullptr ? data : internalStore->GetData());
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
@@ -103,7 +103,14 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Makes the node read and write the state directly in the external buffer,
+     * so the state can be kept by an infer request instead of the graph
+     * @param data a buffer of getStore()->GetSize() bytes, or nullptr to use the internal storage
+     */
+    void bindState(void* data);
  private:
+    MKLDNNMemoryPtr internalStore;
     MKLDNNMemoryPtr dataStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
@@ -136,7 +136,7 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc));
+    createOrSharePrimitive<pooling_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -84,7 +84,7 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
+    createOrSharePrimitive<softmax_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_set>
+#include <utility>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
@@ -47,10 +49,70 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
+/**
+ * Collects memory objects of the body graph which are views on the buffer of the body port memory.
+ * Returns empty vector if the buffer cannot be replaced by changing data handles of these views:
+ * some memory overlaps with the buffer partially, or the views are produced by nodes which are not
+ * allowed to produce them.
+ */
+static std::vector<mkldnn::memory> getBufferViews(MKLDNNGraph &graph, const MKLDNNMemoryPtr &mem,
+                                                  bool allowInputViews, bool allowNodeViews) {
+    auto begin = static_cast<const uint8_t *>(mem->GetPrimitive().get_data_handle());
+    if (begin == nullptr)
+        return {};
+    auto end = begin + mem->GetSize();
+
+    std::vector<mkldnn::memory> views;
+    for (auto &edge : graph.GetEdges()) {
+        const auto &edge_mem = edge->getMemoryPtr();
+        auto edge_begin = static_cast<const uint8_t *>(edge_mem->GetPrimitive().get_data_handle());
+        if (edge_begin == nullptr)
+            continue;
+        auto edge_end = edge_begin + edge_mem->GetSize();
+
+        if (edge_begin == begin && edge_end <= end) {
+            bool is_input_view = edge->getParent()->getType() == Input;
+            if ((is_input_view && !allowInputViews) || (!is_input_view && !allowNodeViews))
+                return {};
+            views.push_back(edge_mem->GetPrimitive());
+        } else if (edge_begin < end && begin < edge_end) {
+            return {};
+        }
+    }
+    return views;
+}
+
+/**
+ * Checks that the chunk of the full tensor has the same dense layout as the body port tensor,
+ * so the body can use the chunk in place.
+ */
+static bool isDenseView(const mkldnn::memory::desc &chunk_desc, const mkldnn::memory::desc &part_desc) {
+    const auto &chunk = chunk_desc.data;
+    const auto &part = part_desc.data;
+    if (chunk.data_type != part.data_type || chunk.ndims != part.ndims ||
+        chunk.format_kind != dnnl_blocked || part.format_kind != dnnl_blocked ||
+        chunk.format_desc.blocking.inner_nblks != 0 || part.format_desc.blocking.inner_nblks != 0 ||
+        chunk.offset0 != 0 || part.offset0 != 0)
+        return false;
+
+    for (int d = 0; d < part.ndims; d++) {
+        if (chunk.dims[d] != part.dims[d] || chunk.padded_dims[d] != part.padded_dims[d])
+            return false;
+        if (part.dims[d] != 1 && chunk.format_desc.blocking.strides[d] != part.format_desc.blocking.strides[d])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Moves chunks of the full tensor to or from the body port. If the views on the body port buffer are passed
+ * and the chunk layout matches the body port layout, the body port is pointed to the chunk instead of copying.
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng)
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng,
+                       std::vector<mkldnn::memory> part_views = {})
                        : sliced_src(sliced_src) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
@@ -84,6 +146,11 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
+        if (!part_views.empty() && isDenseView(chunk_desc, part_blob->GetDescriptor())) {
+            views = std::move(part_views);
+            return;
+        }
+
         if (sliced_src) {
             mem_holder_src = chunk_mem;
             mem_holder_dst = to->GetPrimitive();
@@ -97,19 +164,32 @@ public:
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (!views.empty()) {
+            for (auto &view : views)
+                view.set_data_handle_no_pads_proc(chunk_ptr);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
         reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
 
+    bool isZeroCopy() const {
+        return !views.empty();
+    }
+
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
 
     bool sliced_src;
     mkldnn::memory full_mem;
+    std::vector<mkldnn::memory> views;  // views on the body port buffer, used instead of reorder
 
     int iter_count;
 };
@@ -129,6 +209,31 @@ public:
     }
 };
 
+/**
+ * Back edge which swaps the buffers of the body output and the body input between iterations,
+ * so the output of the previous iteration becomes the input of the next one without copying.
+ * Both buffers are allocated for the whole body execution, so they can be exchanged.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(std::vector<mkldnn::memory> from_views, std::vector<mkldnn::memory> to_views)
+        : from_views(std::move(from_views)), to_views(std::move(to_views)) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            auto from_ptr = from_views.front().get_data_handle();
+            auto to_ptr = to_views.front().get_data_handle();
+            for (auto &view : from_views)
+                view.set_data_handle_no_pads_proc(to_ptr);
+            for (auto &view : to_views)
+                view.set_data_handle_no_pads_proc(from_ptr);
+        }
+    }
+
+private:
+    std::vector<mkldnn::memory> from_views, to_views;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -232,31 +337,80 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // Body ports which are bound to other memory instead of copying. Each buffer can be bound only once.
+    std::unordered_set<const void*> bound;
+    auto bind = [&](const MKLDNNMemoryPtr &mem, bool allowInputViews, bool allowNodeViews) {
+        auto ptr = mem->GetPrimitive().get_data_handle();
+        if (bound.count(ptr))
+            return std::vector<mkldnn::memory>{};
+        auto views = getBufferViews(sub_graph, mem, allowInputViews, allowNodeViews);
+        if (!views.empty())
+            bound.insert(ptr);
+        return views;
+    };
+    auto unbind = [&](const MKLDNNMemoryPtr &mem, const std::vector<mkldnn::memory> &views) {
+        if (!views.empty())
+            bound.erase(mem->GetPrimitive().get_data_handle());
+    };
+
+    // Back edge is replaced by swapping of buffers if the body output and input are used only by this back edge
+    std::map<int, int> back_edge_from_count, back_edge_to_count;
+    for (auto map_rule : ti->back_edges) {
+        back_edge_from_count[map_rule.from]++;
+        back_edge_to_count[map_rule.to]++;
+    }
+    for (auto map_rule : ti->back_edges) {
+        auto from_mem = output_mem[map_rule.from];
+        auto to_mem = input_mem[map_rule.to];
+
+        if (back_edge_from_count[map_rule.from] == 1 && back_edge_to_count[map_rule.to] == 1 &&
+            from_mem->GetDescriptor() == to_mem->GetDescriptor() &&
+            from_mem->GetPrimitive().get_data_handle() != to_mem->GetPrimitive().get_data_handle()) {
+            auto from_views = getBufferViews(sub_graph, from_mem, false, true);
+            auto to_views = getBufferViews(sub_graph, to_mem, true, true);
+            if (!from_views.empty() && !to_views.empty()) {
+                bound.insert(from_mem->GetPrimitive().get_data_handle());
+                bound.insert(to_mem->GetPrimitive().get_data_handle());
+                before_mappers.emplace_back(new BackEdgeSwapHelper(std::move(from_views), std::move(to_views)));
+                continue;
+            }
+        }
+        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+    }
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+        } else {
+            // the body must not write to the chunk of the TensorIterator input
+            auto views = bind(to_mem, true, false);
+            auto mapper = std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng, views);
+            if (!mapper->isZeroCopy())
+                unbind(to_mem, views);
+            before_mappers.emplace_back(mapper);
+        }
     }
 
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
-    }
-
-    for (auto map_rule : ti->back_edges) {
-        auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mem[map_rule.to];
-
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        } else {
+            auto views = bind(from_mem, false, true);
+            auto mapper = std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng, views);
+            if (mapper->isZeroCopy()) {
+                // the body writes the output directly to the chunk, so it is bound before the iteration
+                before_mappers.emplace_back(mapper);
+            } else {
+                unbind(from_mem, views);
+                after_mappers.emplace_back(mapper);
+            }
+        }
     }
 
     // special purpose ports
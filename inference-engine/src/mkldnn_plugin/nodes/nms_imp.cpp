@@ -0,0 +1,118 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#include <algorithm>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+    static inline bool any(vmask_type vmask) { return vmask != 0; }
+    static inline vmask_type cmp(vec_type_f iou, vec_type_f thr, bool equal) {
+        return equal ? _mm512_cmp_ps_mask(iou, thr, _CMP_GE_OQ) : _mm512_cmp_ps_mask(iou, thr, _CMP_GT_OQ);
+    }
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+    static inline bool any(vmask_type vmask) { return _mm_uni_movemask_ps(vmask) != 0; }
+    static inline vmask_type cmp(vec_type_f iou, vec_type_f thr, bool equal) {
+        return equal ? _mm256_cmp_ps(iou, thr, _CMP_GE_OQ) : _mm256_cmp_ps(iou, thr, _CMP_GT_OQ);
+    }
+#elif defined(HAVE_SSE42)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+    static inline bool any(vmask_type vmask) { return _mm_uni_movemask_ps(vmask) != 0; }
+    static inline vmask_type cmp(vec_type_f iou, vec_type_f thr, bool equal) {
+        return equal ? _mm_cmpge_ps(iou, thr) : _mm_cmpgt_ps(iou, thr);
+    }
+#endif
+
+// Overlap of two boxes, 0 for disjoint and degenerate ones. Matches the vector version bit to bit.
+static inline float intersection_over_union(float xmin_i, float ymin_i, float xmax_i, float ymax_i, float area_i,
+                                            float xmin_j, float ymin_j, float xmax_j, float ymax_j, float area_j) {
+    const float width = (std::max)((std::min)(xmax_i, xmax_j) - (std::max)(xmin_i, xmin_j), 0.f);
+    const float height = (std::max)((std::min)(ymax_i, ymax_j) - (std::max)(ymin_i, ymin_j), 0.f);
+    const float intersection = width * height;
+    return intersection > 0.f ? intersection / (area_i + area_j - intersection) : 0.f;
+}
+
+int nms_hard_select(const float* boxes, int count, int stride, const nms_conf& conf,
+                    float* kept, int kept_stride, int num_kept, int* selected) {
+    const float* xmin = boxes;
+    const float* ymin = boxes + stride;
+    const float* xmax = boxes + 2 * stride;
+    const float* ymax = boxes + 3 * stride;
+    const float* area = boxes + 4 * stride;
+    float* kept_xmin = kept;
+    float* kept_ymin = kept + kept_stride;
+    float* kept_xmax = kept + 2 * kept_stride;
+    float* kept_ymax = kept + 3 * kept_stride;
+    float* kept_area = kept + 4 * kept_stride;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vzero = _mm_uni_setzero_ps();
+    const vec_type_f vthreshold = _mm_uni_set1_ps(conf.iou_threshold);
+#endif
+
+    for (int i = 0; i < count && num_kept < conf.max_output_boxes; i++) {
+        bool suppressed = false;
+        int k = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // the tail of the last block is filled with empty boxes, which never overlap
+        const vec_type_f vxmin_i = _mm_uni_set1_ps(xmin[i]);
+        const vec_type_f vymin_i = _mm_uni_set1_ps(ymin[i]);
+        const vec_type_f vxmax_i = _mm_uni_set1_ps(xmax[i]);
+        const vec_type_f vymax_i = _mm_uni_set1_ps(ymax[i]);
+        const vec_type_f varea_i = _mm_uni_set1_ps(area[i]);
+        for (; k < num_kept && !suppressed; k += block_size) {
+            vec_type_f vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(vxmax_i, _mm_uni_loadu_ps(kept_xmax + k)),
+                                               _mm_uni_max_ps(vxmin_i, _mm_uni_loadu_ps(kept_xmin + k)));
+            vec_type_f vheight = _mm_uni_sub_ps(_mm_uni_min_ps(vymax_i, _mm_uni_loadu_ps(kept_ymax + k)),
+                                                _mm_uni_max_ps(vymin_i, _mm_uni_loadu_ps(kept_ymin + k)));
+            vec_type_f vintersection = _mm_uni_mul_ps(_mm_uni_max_ps(vwidth, vzero), _mm_uni_max_ps(vheight, vzero));
+            vec_type_f vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea_i, _mm_uni_loadu_ps(kept_area + k)), vintersection);
+            vec_type_f viou = _mm_uni_blendv_ps(vzero, _mm_uni_div_ps(vintersection, vunion), _mm_uni_cmpgt_ps(vintersection, vzero));
+            suppressed = any(cmp(viou, vthreshold, conf.suppress_equal));
+        }
+#endif
+        for (; k < num_kept && !suppressed; k++) {
+            const float iou = intersection_over_union(xmin[i], ymin[i], xmax[i], ymax[i], area[i],
+                                                      kept_xmin[k], kept_ymin[k], kept_xmax[k], kept_ymax[k], kept_area[k]);
+            suppressed = conf.suppress_equal ? iou >= conf.iou_threshold : iou > conf.iou_threshold;
+        }
+        if (suppressed)
+            continue;
+
+        if (num_kept % nms_block_size == 0) {
+            for (int plane = 0; plane < nms_box_planes; plane++)
+                std::memset(kept + plane * kept_stride + num_kept, 0, nms_block_size * sizeof(float));
+        }
+        kept_xmin[num_kept] = xmin[i];
+        kept_ymin[num_kept] = ymin[i];
+        kept_xmax[num_kept] = xmax[i];
+        kept_ymax[num_kept] = ymax[i];
+        kept_area[num_kept] = area[i];
+        selected[num_kept++] = i;
+    }
+    return num_kept;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
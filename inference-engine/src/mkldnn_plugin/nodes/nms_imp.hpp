@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct nms_conf {
+    float iou_threshold;
+    bool suppress_equal;     // NonMaxSuppression drops boxes with iou == threshold, DetectionOutput keeps them
+    int max_output_boxes;
+};
+
+// boxes are stored as 5 planes (xmin, ymin, xmax, ymax, area) of the padded size each
+constexpr int nms_box_planes = 5;
+constexpr int nms_block_size = 16;
+
+inline int nms_padded_size(int count) {
+    return (count + nms_block_size - 1) / nms_block_size * nms_block_size;
+}
+
+namespace XARCH {
+
+/**
+ * Greedy hard NMS over candidates sorted by descending score. Each candidate is checked against
+ * the boxes kept so far block by block and is dropped on the first block with an overlap over the threshold.
+ * Continues the selection of num_kept boxes already stored in the kept planes, so candidates may come in chunks.
+ * Returns the new number of kept boxes and appends positions of the kept candidates to selected.
+ */
+int nms_hard_select(const float* boxes, int count, int stride, const nms_conf& conf,
+                    float* kept, int kept_stride, int num_kept, int* selected);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -13,6 +13,7 @@
 #include <queue>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "common/nms.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -144,29 +145,26 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    void boxCorners(const float *box, float &xmin, float &ymin, float &xmax, float &ymax) {
         if (boxEncodingType == boxEncoding::CENTER) {
             //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+            ymin = box[1] - box[3] / 2.f;
+            xmin = box[0] - box[2] / 2.f;
+            ymax = box[1] + box[3] / 2.f;
+            xmax = box[0] + box[2] / 2.f;
         } else {
             //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+            ymin = (std::min)(box[0], box[2]);
+            xmin = (std::min)(box[1], box[3]);
+            ymax = (std::max)(box[0], box[2]);
+            xmax = (std::max)(box[1], box[3]);
         }
+    }
+
+    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
+        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+        boxCorners(boxesI, xminI, yminI, xmaxI, ymaxI);
+        boxCorners(boxesJ, xminJ, yminJ, xmaxJ, ymaxJ);
 
         float areaI = (ymaxI - yminI) * (xmaxI - xminI);
         float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
@@ -258,41 +256,31 @@ public:
 
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
-        int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        nms_conf conf;
+        conf.iou_threshold = iou_threshold;
+        conf.suppress_equal = true;
+        conf.max_output_boxes = static_cast<int>((std::min)(max_output_boxes_per_class, num_boxes));
+
+        workspaces.prepare(static_cast<int>(num_boxes));
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
             const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            NmsWorkspace &workspace = workspaces.local();
+            workspace.candidates.clear();
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                 if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                    workspace.candidates.push_back({scoresPtr[box_idx], box_idx});
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+            int io_selection_size = nms_hard(workspace, -1, conf, [&](int box_idx, float &xmin, float &ymin, float &xmax, float &ymax) {
+                boxCorners(&boxesPtr[box_idx * 4], xmin, ymin, xmax, ymax);
+            });
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            for (int i = 0; i < io_selection_size; i++) {
+                const NmsCandidate &candidate = workspace.candidates[workspace.selected[i]];
+                filtBoxes[offset + i] = filteredBoxes(candidate.score, batch_idx, class_idx, candidate.index);
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
         });
@@ -441,6 +429,7 @@ private:
     float scale;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    NmsWorkspaces workspaces;
     const std::string inType = "input", outType = "output";
     std::string logPrefix;
 
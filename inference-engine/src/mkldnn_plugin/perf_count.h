@@ -4,32 +4,96 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * One execution: start and finish in nanoseconds of the steady clock and the index of the thread which ran it.
+ */
+struct PerfSample {
+    uint64_t start;
+    uint64_t finish;
+    uint32_t thread;
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    std::chrono::steady_clock::time_point __start = {};
+    std::chrono::steady_clock::time_point __finish = {};
+
+    // ring buffer with the last executions, it is empty unless the history is enabled
+    std::vector<PerfSample> history;
+    size_t historyPos = 0;
+    size_t historyCount = 0;
 
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // average execution time in microseconds
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    void enableHistory(size_t size) {
+        history.assign(size, PerfSample{});
+        historyPos = 0;
+        historyCount = 0;
+    }
+
+    // the kept executions from the oldest to the latest one
+    std::vector<PerfSample> samples() const {
+        std::vector<PerfSample> result;
+        result.reserve(historyCount);
+        const size_t first = historyCount < history.size() ? 0 : historyPos;
+        for (size_t i = 0; i < historyCount; i++)
+            result.push_back(history[(first + i) % history.size()]);
+        return result;
+    }
+
+    // nearest-rank percentile of the execution time of the kept executions in nanoseconds, 0 if nothing is kept
+    uint64_t percentile(double p) const {
+        if (historyCount == 0)
+            return 0;
+        std::vector<uint64_t> durations;
+        durations.reserve(historyCount);
+        for (size_t i = 0; i < historyCount; i++)
+            durations.push_back(history[i].finish - history[i].start);
+        const double rank = std::ceil(p / 100.0 * durations.size() - 1e-9);
+        const size_t index = rank < 1.0 ? 0 : (std::min)(static_cast<size_t>(rank) - 1, durations.size() - 1);
+        std::nth_element(durations.begin(), durations.begin() + index, durations.end());
+        return durations[index];
+    }
 
 private:
+    static uint32_t threadIndex() {
+        static std::atomic<uint32_t> threads(0);
+        static thread_local uint32_t index = threads++;
+        return index;
+    }
+
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = std::chrono::steady_clock::now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
+        __finish = std::chrono::steady_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        const uint64_t start = std::chrono::duration_cast<std::chrono::nanoseconds>(__start.time_since_epoch()).count();
+        const uint64_t finish = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish.time_since_epoch()).count();
+        duration += finish - start;
         num++;
+
+        if (!history.empty()) {
+            history[historyPos] = {start, finish, threadIndex()};
+            historyPos = (historyPos + 1) % history.size();
+            historyCount = (std::min)(historyCount + 1, history.size());
+        }
     }
 
     friend class PerfHelper;
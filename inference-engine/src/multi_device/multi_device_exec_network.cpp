@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -48,22 +49,52 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+void DeviceStatistics::OnComplete(Duration latency) {
+    _inFlight--;
+    // exponential moving average with 1/8 weight of a new sample, the first sample is taken as is
+    // (a concurrent update may be lost which is fine for the estimation)
+    const std::int64_t sample = latency.count();
+    const std::int64_t average = _averageLatency.load();
+    _averageLatency.store(0 == average ? sample : average + (sample - average) / 8);
+}
+
+DeviceStatistics::Duration DeviceStatistics::ExpectedCompletion() const {
+    const auto latency = GetAverageLatency();
+    const int numRequests = std::max(1, static_cast<int>(_numRequests));
+    // requests in flight and queued ones plus the new one
+    const int pending = _inFlight.load() + _queued.load() + 1;
+    if (pending <= numRequests) {
+        return latency;
+    }
+    if (latency == Duration::zero()) {
+        return Duration::max();
+    }
+    // each round of the device requests takes the average latency
+    const int waitRounds = (pending - 1) / numRequests;
+    return latency * (waitRounds + 1);
+}
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end() &&
+        itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_POLICY_EARLIEST_COMPLETION) {
+        _schedulingPolicy = SchedulingPolicy::EARLIEST_COMPLETION;
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -74,7 +105,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
@@ -82,14 +113,17 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
+        auto* deviceStatisticsPtr = &(_deviceStatistics[device]);
+        deviceStatisticsPtr->SetNumRequests(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    deviceStatisticsPtr->OnComplete(std::chrono::steady_clock::now() - workerRequestPtr->_startTime);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -101,40 +135,100 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         Task t;
                         if (_inferPipelineTasks.try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            deviceStatisticsPtr->OnDequeued();
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
     }
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+std::shared_ptr<const std::vector<DeviceInformation>> MultiDeviceExecutableNetwork::GetDevicePriorities() const {
+    return std::atomic_load(&_devicePriorities);
+}
+
+bool MultiDeviceExecutableNetwork::RunOnIdleWorkerInferRequest(Task& inferPipelineTask, const DeviceName& device) {
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device];
+    if (!idleWorkerRequests.try_pop(workerRequestPtr)) {
+        return false;
+    }
+    IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+    auto& deviceStatistics = _deviceStatistics.at(device);
+    _thisWorkerInferRequest = workerRequestPtr;
+    workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+    deviceStatistics.OnStart();
+    try {
+        auto capturedTask = std::move(inferPipelineTask);
+        capturedTask();
+    } catch (...) {
+        deviceStatistics.OnCancel();
+        throw;
+    }
+    idleGuard.Release();
+    return true;
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToEarliestCompletion(Task inferPipelineTask,
+                                                                const std::vector<DeviceInformation>& devices) {
+    // the first device with the minimal expected completion time, so equal estimates respect the priorities
+    const DeviceInformation* bestDevice = nullptr;
+    auto bestCompletion = DeviceStatistics::Duration::max();
     for (auto&& device : devices) {
+        const auto completion = _deviceStatistics.at(device.deviceName).ExpectedCompletion();
+        if (completion < bestCompletion) {
+            bestCompletion = completion;
+            bestDevice = &device;
+        }
+    }
+
+    // all devices are busy and have no measurements yet, any of them can take the task
+    if (nullptr == bestDevice) {
+        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        return;
+    }
+
+    const auto& deviceName = bestDevice->deviceName;
+    if (RunOnIdleWorkerInferRequest(inferPipelineTask, deviceName)) {
+        return;
+    }
+
+    // the device is busy but is still expected to complete the task first, so the task waits for it
+    auto& deviceStatistics = _deviceStatistics.at(deviceName);
+    auto& deviceTasks = *_inferPipelineTasksDeviceSpecific.at(deviceName);
+    deviceStatistics.OnQueued();
+    deviceTasks.push(std::move(inferPipelineTask));
+
+    // a request of the device could become idle before the task was queued, so nobody would pop it
+    Task task;
+    if (deviceTasks.try_pop(task)) {
+        deviceStatistics.OnDequeued();
+        ScheduleToWorkerInferRequest(std::move(task), deviceName);
+    }
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
+    auto devices = GetDevicePriorities();
+    if (SchedulingPolicy::EARLIEST_COMPLETION == _schedulingPolicy && preferred_device.empty() && !devices->empty()) {
+        ScheduleToEarliestCompletion(std::move(inferPipelineTask), *devices);
+        return;
+    }
+    for (auto&& device : *devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        WorkerInferRequest* workerRequestPtr = nullptr;
-        NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            _thisWorkerInferRequest = workerRequestPtr;
-            {
-                auto capturedTask = std::move(inferPipelineTask);
-                capturedTask();
-            }
-            idleGuard.Release();
+        if (RunOnIdleWorkerInferRequest(inferPipelineTask, device.deviceName)) {
             return;
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        _deviceStatistics.at(preferred_device).OnQueued();
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -142,10 +236,7 @@ void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
-    {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
-    }
+    std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>());
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
      */
@@ -157,13 +248,10 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
 }
 
 RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    auto devices = GetDevicePriorities();
 
     std::string devices_names;
-    for (auto&& device : devices) {
+    for (auto&& device : *devices) {
         devices_names += device.deviceName + " ";
         const auto& n  = _networksPerDevice.at(device.deviceName);
         try {
@@ -197,6 +285,7 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
     IInferRequest::Ptr asyncRequest;
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    syncRequestImpl->setSharedPreProcessGraphCache(_preProcGraphCache);
     auto asyncTreadSafeImpl = std::make_shared<MultiDeviceAsyncInferRequest>(std::static_pointer_cast<MultiDeviceInferRequest>(syncRequestImpl),
                                                                              _needPerfCounters,
                                                                              std::static_pointer_cast<MultiDeviceExecutableNetwork>(shared_from_this()),
@@ -232,7 +321,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(metaDevices));
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -276,7 +365,8 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,6 +6,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -34,6 +37,39 @@ struct DeviceInformation {
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
+/**
+ * @brief Moving average latency and load of a device used by the earliest completion scheduling policy.
+ * Updated and read concurrently without locks, so the values are approximate.
+ */
+class DeviceStatistics {
+public:
+    using Duration = std::chrono::nanoseconds;
+
+    void SetNumRequests(unsigned int numRequests) { _numRequests = numRequests; }
+
+    void OnStart()    { _inFlight++; }
+    void OnCancel()   { _inFlight--; }
+    void OnQueued()   { _queued++; }
+    void OnDequeued() { _queued--; }
+    void OnComplete(Duration latency);
+
+    Duration GetAverageLatency() const { return Duration{_averageLatency.load()}; }
+
+    /**
+     * @brief Expected time to complete one more request if it is given to the device now:
+     * the request starts immediately if the device has an idle infer request,
+     * otherwise it waits for the requests in flight and the queued ones
+     * @return Duration::max() if the device is busy and no latency was measured yet
+     */
+    Duration ExpectedCompletion() const;
+
+private:
+    std::atomic<std::int64_t> _averageLatency = {0};
+    std::atomic<int>          _inFlight = {0};
+    std::atomic<int>          _queued = {0};
+    unsigned int              _numRequests = 0;
+};
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
@@ -102,7 +138,9 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
     };
+    enum class SchedulingPolicy { PRIORITY, EARLIEST_COMPLETION };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
@@ -121,6 +159,9 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    void ScheduleToEarliestCompletion(InferenceEngine::Task, const std::vector<DeviceInformation>& devices);
+    bool RunOnIdleWorkerInferRequest(InferenceEngine::Task& inferPipelineTask, const DeviceName& device);
+    std::shared_ptr<const std::vector<DeviceInformation>> GetDevicePriorities() const;
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -128,13 +169,16 @@ public:
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
     mutable std::mutex                                          _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    // replaced as a whole and read via std::atomic_load, so the scheduling takes a snapshot without locking
+    std::shared_ptr<const std::vector<DeviceInformation>>       _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::PRIORITY;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
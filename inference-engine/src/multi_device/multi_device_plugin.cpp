@@ -20,6 +20,15 @@
 namespace MultiDevicePlugin {
     using namespace InferenceEngine;
 namespace {
+    void CheckSchedulingPolicy(const std::map<std::string, std::string> & config) {
+        auto it = config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        if (it != config.end() &&
+            it->second != MULTI_CONFIG_VALUE(POLICY_PRIORITY) &&
+            it->second != MULTI_CONFIG_VALUE(POLICY_EARLIEST_COMPLETION)) {
+            THROW_IE_EXCEPTION << "Unsupported value for KEY_MULTI_SCHEDULING_POLICY: " << it->second;
+        }
+    }
+
     std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
                                                     const std::map<std::string, std::string> & local) {
         for (auto && kvp : local) {
@@ -109,12 +118,16 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(POLICY_PRIORITY)} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
 }
 
 void MultiDeviceInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    CheckSchedulingPolicy(config);
     for (auto && kvp : config) {
         _config[kvp.first] = kvp.second;
     }
@@ -141,6 +154,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -164,11 +178,15 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
         THROW_IE_EXCEPTION << "KEY_MULTI_DEVICE_PRIORITIES key is not set for MULTI device";
     }
 
+    CheckSchedulingPolicy(fullConfig);
     auto metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] =
+        policy == fullConfig.end() ? std::string{MULTI_CONFIG_VALUE(POLICY_PRIORITY)} : policy->second;
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     std::mutex load_mutex;
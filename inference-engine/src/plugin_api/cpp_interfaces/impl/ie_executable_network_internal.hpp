@@ -138,6 +138,12 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     IInferencePlugin::Ptr _plugin;
+
+    /**
+     * @brief A cache of compiled pre-processing graphs shared by all infer requests of the network.
+     * @note Should be passed to infer requests via InferRequestInternal::setSharedPreProcessGraphCache.
+     */
+    SharedPreProcessGraphCache::Ptr _preProcGraphCache = std::make_shared<SharedPreProcessGraphCache>();
 };
 
 }  // namespace InferenceEngine
@@ -38,6 +38,7 @@ public:
         IInferRequest::Ptr asyncRequest;
         auto asyncRequestImpl = this->CreateAsyncInferRequestImpl(_networkInputs, _networkOutputs);
         asyncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        asyncRequestImpl->setSharedPreProcessGraphCache(_preProcGraphCache);
 
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestInternal>(asyncRequestImpl), [](IInferRequest* p) {
             p->Release();
@@ -6,6 +6,7 @@
 
 #include <ie_icnn_network.hpp>
 #include <ie_input_info.hpp>
+#include <cstdio>
 #include <map>
 #include <memory>
 #include <string>
@@ -225,6 +226,14 @@ public:
         _exeNetwork = exeNetwork;
     }
 
+    /**
+     * @brief      Sets the cache of compiled pre-processing graphs shared with other infer requests.
+     * @param[in]  cache  The cache owned by the executable network
+     */
+    void setSharedPreProcessGraphCache(const SharedPreProcessGraphCache::Ptr& cache) {
+        _preProcGraphCache = cache;
+    }
+
     /**
      * @brief      Checks that both inputs and outputs blob are valid. Throws an exception if they are not.
      */
@@ -257,6 +266,30 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     std::shared_ptr<ExecutableNetworkInternal> _exeNetwork;
+
+    /**
+     * @brief A cache of compiled pre-processing graphs shared by infer requests of the executable network
+     */
+    SharedPreProcessGraphCache::Ptr _preProcGraphCache;
+
+    /**
+     * @brief Adds hits and misses of the compiled pre-processing graphs cache per input to performance counters
+     * @param perfMap A map of performance counters to add the pre-processing entries to
+     */
+    void getPreProcessingPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+        for (auto&& preProcData : _preProcData) {
+            size_t hits = 0, misses = 0;
+            preProcData.second->getGraphCacheStats(hits, misses);
+
+            InferenceEngineProfileInfo info = {};
+            info.status = (hits + misses) > 0 ? InferenceEngineProfileInfo::EXECUTED
+                                              : InferenceEngineProfileInfo::NOT_RUN;
+            snprintf(info.layer_type, sizeof(info.layer_type), "%s", "PreProcessing");
+            snprintf(info.exec_type, sizeof(info.exec_type), "graph_cache_hits_%zu_misses_%zu", hits, misses);
+            perfMap["PreProcessing_" + preProcData.first] = info;
+        }
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      * @param inputs Inputs blobs to perform preprocessing on
@@ -407,6 +440,9 @@ protected:
         auto ppDataIt = _preProcData.find(name);
         if (ppDataIt == _preProcData.end()) {
             ppDataIt = (_preProcData.emplace(name, CreatePreprocDataHelper())).first;
+            if (_preProcGraphCache) {
+                _preProcGraphCache->attach(**ppDataIt->second);
+            }
         }
 
         auto& preproc_ptr = ppDataIt->second;
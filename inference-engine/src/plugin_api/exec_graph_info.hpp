@@ -51,6 +51,18 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a median of execution time of the executable primitive over the kept executions.
+ */
+static const char PERF_COUNTER_P50[] = "execTimeP50Mcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a 99th percentile of execution time of the executable primitive over the kept executions.
+ */
+static const char PERF_COUNTER_P99[] = "execTimeP99Mcs";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
@@ -84,6 +96,7 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
  * - ExecGraphInfoSerialization::PERF_COUNTER
+ * - ExecGraphInfoSerialization::PERF_COUNTER_P50 and PERF_COUNTER_P99 (if the executions are kept)
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
@@ -29,6 +29,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -83,6 +85,14 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns a streams executor with the same configuration even if it is used by other owners,
+     *        so owners can share streams and order their tasks with IStreamsExecutor::TaskPriority
+     * @param config A streams executor configuration
+     * @return A shared pointer to existing or newly created streams executor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
@@ -44,6 +44,16 @@ public:
         NUMA     //!< Bind threads to NUMA nodes
     };
 
+    /**
+     * @brief Defines priority of a task submitted to the executor.
+     *        Pending tasks with higher priority are started before pending tasks with lower priority.
+     */
+    enum class TaskPriority : std::uint8_t {
+        HIGH,    //!< Latency critical tasks
+        NORMAL,  //!< Default priority
+        LOW      //!< Bulk tasks which can be postponed
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -135,6 +145,16 @@ public:
     * @param task A task to start
     */
     virtual void Execute(Task task) = 0;
+
+    using ITaskExecutor::run;
+
+    /**
+    * @brief Execute the task in one of the streams with the specified priority.
+    *        Default implementation ignores the priority and calls run(Task)
+    * @param task A task to start
+    * @param priority A priority of the task
+    */
+    virtual void run(Task task, TaskPriority priority);
 };
 
 
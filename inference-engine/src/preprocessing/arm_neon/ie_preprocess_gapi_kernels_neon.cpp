@@ -126,6 +126,22 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const uint8_t in[], uint16_t out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const float in[], uint16_t out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
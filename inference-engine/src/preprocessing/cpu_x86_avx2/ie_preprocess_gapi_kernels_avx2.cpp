@@ -562,6 +562,22 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const uint8_t in[], uint16_t out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow(const float in[], uint16_t out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
 void calcRowLinear_32F(float *dst[],
                        const float *src0[],
                        const float *src1[],
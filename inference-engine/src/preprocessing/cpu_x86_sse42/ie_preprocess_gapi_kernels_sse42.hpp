@@ -199,6 +199,12 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+// Normalization (x - mean) * scale, BF16 output is stored as uint16_t
+void normalizeRow(const uint8_t in[], float out[], float mean, float scale, int length);
+void normalizeRow(const float in[], float out[], float mean, float scale, int length);
+void normalizeRow(const uint8_t in[], uint16_t out[], float mean, float scale, int length);
+void normalizeRow(const float in[], uint16_t out[], float mean, float scale, int length);
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -29,6 +29,11 @@ class PreProcessData : public IPreProcessData {
      */
     std::shared_ptr<PreprocEngine> _preproc;
 
+    /**
+     * @brief Cache of compiled graphs used by the engine, may be shared with other objects.
+     */
+    PreprocEngine::GraphCachePtr _graphCache = std::make_shared<PreprocEngine::GraphCache>();
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
@@ -39,6 +44,10 @@ public:
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+    void shareGraphCache(const IPreProcessData &other) override;
+
+    void getGraphCacheStats(size_t &hits, size_t &misses) const override;
 };
 
 StatusCode CreatePreProcessData(IPreProcessData *& data, ResponseDesc * /*resp*/) noexcept {
@@ -65,6 +74,13 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
     auto algorithm = info.getResizeAlgorithm();
     auto fmt = info.getColorFormat();
 
+    PreprocEngine::Normalization normalization;
+    if (info.getFusedNormalization()) {
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            normalization.emplace_back(info[c]->meanValue, info[c]->stdScale);
+        }
+    }
+
     if (_userBlob == nullptr || preprocessedBlob == nullptr) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with null " << (_userBlob == nullptr ? "_userBlob" : "preprocessedBlob");
     }
@@ -72,14 +88,27 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
 
     if (!_preproc) {
-        _preproc.reset(new PreprocEngine);
+        _preproc.reset(new PreprocEngine(_graphCache));
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, normalization, serial, batchSize);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     PreprocEngine::checkApplicabilityGAPI(src, dst);
 }
 
+void PreProcessData::shareGraphCache(const IPreProcessData &other) {
+    // both objects are created by this library
+    _graphCache = static_cast<const PreProcessData &>(other)._graphCache;
+    _preproc.reset();
+}
+
+void PreProcessData::getGraphCacheStats(size_t &hits, size_t &misses) const {
+    hits = misses = 0;
+    if (_preproc) {
+        _preproc->getGraphCacheStats(hits, misses);
+    }
+}
+
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
 
 #include <ie_blob.h>
 #include <file_utils.h>
@@ -58,6 +59,19 @@ public:
 
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
+
+    /**
+     * @brief Makes pre-processing use the cache of compiled pre-processing graphs of another object.
+     * @param other pre-processing data owning the cache, e.g. the one shared by all infer requests of a network.
+     */
+    virtual void shareGraphCache(const IPreProcessData &other) = 0;
+
+    /**
+     * @brief Gets numbers of executions which reused a compiled pre-processing graph and which had to compile one.
+     * @param hits number of executions which reused a compiled graph.
+     * @param misses number of executions which compiled or reshaped a graph.
+     */
+    virtual void getGraphCacheStats(size_t &hits, size_t &misses) const = 0;
 };
 
 INFERENCE_PRERPOC_PLUGIN_API(StatusCode) CreatePreProcessData(IPreProcessData *& data, ResponseDesc *resp) noexcept;
@@ -96,4 +110,33 @@ inline PreProcessDataPtr CreatePreprocDataHelper() {
     return PreProcessDataPtr(preprocLibraryPath);
 }
 
+/**
+ * @brief Holds pre-processing data which owns the cache of compiled pre-processing graphs shared by
+ * all infer requests of one executable network. The data is created on the first use only, so the
+ * pre-processing library is not loaded for networks which do not need pre-processing.
+ */
+class SharedPreProcessGraphCache {
+public:
+    /**
+     * @brief A shared pointer to SharedPreProcessGraphCache object
+     */
+    using Ptr = std::shared_ptr<SharedPreProcessGraphCache>;
+
+    /**
+     * @brief Makes pre-processing data use the shared cache of compiled graphs.
+     * @param data pre-processing data of an infer request input.
+     */
+    void attach(IPreProcessData &data) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_owner) {
+            _owner = CreatePreprocDataHelper();
+        }
+        data.shareGraphCache(**_owner);
+    }
+
+private:
+    std::mutex _mutex;
+    PreProcessDataPtr _owner;
+};
+
 }  // namespace InferenceEngine
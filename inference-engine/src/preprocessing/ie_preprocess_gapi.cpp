@@ -81,6 +81,8 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     case Precision::U8:   return CV_8U;
     case Precision::FP32: return CV_32F;
     case Precision::U16:  return CV_16U;
+    // there is no BF16 depth in G-API, the values are stored as 16-bit integers
+    case Precision::BF16: return CV_16S;
 
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
@@ -543,17 +545,58 @@ convertColorPlanar(const std::vector<cv::GMat>& inputs,
     return planes;
 }
 
+// mean values and scales are applied by the same kernel which converts planes to the output
+// precision. BF16 output is supported by this kernel only, so it is used with no-op normalization
+PreprocEngine::Normalization getNormalization(const G::Desc &in_desc,
+                                              const G::Desc &out_desc,
+                                              const PreprocEngine::Normalization &normalization) {
+    if (in_desc.prec == CV_16S) {
+        THROW_IE_EXCEPTION << "BF16 input precision is not supported [by G-API]";
+    }
+
+    if (normalization.empty()) {
+        if (out_desc.prec == CV_16S) {
+            return PreprocEngine::Normalization(out_desc.d.C, {0.f, 1.f});
+        }
+        return normalization;
+    }
+
+    if (out_desc.prec != CV_32F && out_desc.prec != CV_16S) {
+        THROW_IE_EXCEPTION << "Mean values and scales can be applied by pre-processing only if "
+                           << "network's input precision is FP32 or BF16";
+    }
+    if (static_cast<int>(normalization.size()) != out_desc.d.C) {
+        THROW_IE_EXCEPTION << "Number of mean values " << normalization.size()
+                           << " != network's expected number of channels " << out_desc.d.C;
+    }
+    return normalization;
+}
+
+std::vector<cv::GMat> normalize(const std::vector<cv::GMat>& planes,
+                                int out_prec,
+                                const PreprocEngine::Normalization &normalization) {
+    std::vector<cv::GMat> normalized;
+    for (size_t i = 0; i < planes.size(); i++) {
+        normalized.emplace_back(gapi::NormalizePlane::on(planes[i], out_prec,
+            normalization[i].first, normalization[i].second));
+    }
+    return normalized;
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             Layout in_layout,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::Normalization &requested_normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
 
+    const auto normalization = getNormalization(in_desc, out_desc, requested_normalization);
+
     std::vector<cv::GMat> inputs;  // 1 element if NHWC, C elements if NCHW
     if (in_layout == NHWC) {
         inputs.resize(1);
@@ -565,6 +608,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
     // 2. Supports bilinear resize only
     // 3. Supports NV12/I420 -> RGB/BGR color transformations
+    // 4. Output is U8 or normalized FP32/BF16
     const bool nv12_input = (input_color_format == ColorFormat::NV12);
     const bool i420_input = (input_color_format == ColorFormat::I420);
     const bool specific_yuv420_input_handling = (nv12_input || i420_input)
@@ -574,7 +618,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec || !normalization.empty()))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -609,6 +653,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (!normalization.empty()) {
+            planes = normalize(planes, out_desc.prec, normalization);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -664,7 +712,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (!normalization.empty()) {
+        outputs = normalize(outputs, out_desc.prec, normalization);
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -684,31 +734,93 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr size_t PreprocEngine::GraphCache::DEFAULT_CAPACITY;
+
+PreprocEngine::GraphCache::GraphCache(size_t capacity) : _capacity(capacity) {}
+
+size_t PreprocEngine::GraphCache::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+bool PreprocEngine::GraphCache::take(const CallDesc &call, Entry &entry, Update &update) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto found = std::find_if(_entries.begin(), _entries.end(), [&](const Entry &e) {
+        return Update::NOTHING == needUpdate(e.call, call);
+    });
+    update = Update::NOTHING;
+
+    // While the cache is not full, a new graph is compiled to populate it. Otherwise
+    // reshaping an old graph is cheaper than compiling a new one and evicting the old
+    if (found == _entries.end() && _entries.size() >= _capacity) {
+        auto rfound = std::find_if(_entries.rbegin(), _entries.rend(), [&](const Entry &e) {
+            return Update::RESHAPE == needUpdate(e.call, call);
+        });
+        if (rfound != _entries.rend()) {
+            found = std::prev(rfound.base());
+            update = Update::RESHAPE;
+        }
+    }
+
+    if (found == _entries.end()) {
+        return false;
+    }
+
+    entry = std::move(*found);
+    _entries.erase(found);
+    return true;
+}
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+void PreprocEngine::GraphCache::put(Entry &&entry) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _entries.emplace_front(std::move(entry));
+    while (_entries.size() > _capacity) {
+        _entries.pop_back();
+    }
+}
+
+PreprocEngine::PreprocEngine() : PreprocEngine(std::make_shared<GraphCache>()) {}
+
+PreprocEngine::PreprocEngine(const GraphCachePtr &graphCache)
+    : _lastComp(parallel_get_max_threads()), _graphCache(graphCache) {
+    IE_ASSERT(_graphCache);
+}
+
+PreprocEngine::~PreprocEngine() {
+    // let other engines sharing the cache reuse the graph
+    if (_lastCall) {
+        _graphCache->put(GraphCache::Entry{std::move(_lastCall.value()), std::move(_lastComp)});
+    }
+}
+
+void PreprocEngine::getGraphCacheStats(size_t &hits, size_t &misses) const {
+    hits = _graphCacheHits;
+    misses = _graphCacheMisses;
+}
+
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. mean values or scales have changed (kernel parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -724,7 +836,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -757,6 +869,36 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+PreprocEngine::Update PreprocEngine::acquireGraph(const CallDesc &newCall) {
+    if (_lastCall && Update::NOTHING == needUpdate(_lastCall.value(), newCall)) {
+        _graphCacheHits++;
+        return Update::NOTHING;
+    }
+
+    // the current graph doesn't fit, return it to the cache and look for another one
+    if (_lastCall) {
+        _graphCache->put(GraphCache::Entry{std::move(_lastCall.value()), std::move(_lastComp)});
+    }
+
+    GraphCache::Entry entry;
+    Update update = Update::REBUILD;
+    if (_graphCache->take(newCall, entry, update)) {
+        _lastComp = std::move(entry.comp);
+    } else {
+        update = Update::REBUILD;
+        _lastComp = std::vector<cv::GCompiled>(parallel_get_max_threads());
+    }
+
+    if (Update::NOTHING == update) {
+        _graphCacheHits++;
+    } else {
+        _graphCacheMisses++;
+    }
+    _lastCall = cv::util::make_optional(newCall);
+
+    return update;
+}
+
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
@@ -896,8 +1038,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt,
+    const Normalization &normalization, bool omp_serial, int batch_size) {
 
     validateBlob(inBlob);
 
@@ -939,19 +1081,18 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  normalization };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (algorithm == NO_RESIZE && normalization.empty() && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    const Update update = acquireGraph(thisCall);
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
         if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
@@ -964,7 +1105,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           normalization));
         }
     }
 
@@ -976,7 +1118,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, const Normalization &normalization,
+        bool omp_serial, int batch_size) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -995,8 +1138,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1004,8 +1147,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
 
     default:
@@ -1014,8 +1157,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, normalization,
+            omp_serial, batch_size);
     }
 }
 }  // namespace InferenceEngine
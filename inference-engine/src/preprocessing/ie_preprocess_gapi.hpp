@@ -8,7 +8,12 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -21,20 +26,33 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    // Mean value and scale per output channel, empty if the output is not normalized
+    using Normalization = std::vector<std::pair<float, float>>;
+
+    class GraphCache;
+    using GraphCachePtr = std::shared_ptr<GraphCache>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
 
+    GraphCachePtr _graphCache;
+    std::atomic<size_t> _graphCacheHits{0};
+    std::atomic<size_t> _graphCacheMisses{0};
+
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
+    Update acquireGraph(const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
@@ -45,15 +63,50 @@ class PreprocEngine {
 
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt,
+        const Normalization &normalization, bool omp_serial, int batch_size);
 
 public:
+    // Bounded LRU cache of compiled graphs which can be shared by several engines
+    // (e.g. by all infer requests of one executable network). An engine takes a graph
+    // out of the cache for exclusive use and puts it back once its call descriptor changes.
+    class GraphCache {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 16;
+
+        explicit GraphCache(size_t capacity = DEFAULT_CAPACITY);
+
+        size_t capacity() const { return _capacity; }
+        size_t size() const;
+
+    private:
+        friend class PreprocEngine;
+
+        struct Entry {
+            CallDesc call;
+            std::vector<cv::GCompiled> comp;
+        };
+
+        // Takes out the most recently used graph compiled for the call. If there is no such
+        // graph and the cache is full, takes out the least recently used graph which can be
+        // reshaped to the call instead of compiling a new one
+        bool take(const CallDesc &call, Entry &entry, Update &update);
+        void put(Entry &&entry);
+
+        const size_t _capacity;
+        mutable std::mutex _mutex;
+        std::list<Entry> _entries;  // most recently used first
+    };
+
     PreprocEngine();
+    explicit PreprocEngine(const GraphCachePtr &graphCache);
+    ~PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, const Normalization &normalization, bool omp_serial, int batch_size = -1);
+    // Number of calls which reused a compiled graph and which had to build one
+    void getGraphCacheStats(size_t &hits, size_t &misses) const;
 };
 
 }  // namespace InferenceEngine
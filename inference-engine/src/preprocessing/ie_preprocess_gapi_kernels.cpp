@@ -2399,6 +2399,83 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+template<typename DstT> DstT cast_normalized(float x);
+template<> float    cast_normalized(float x) { return x; }
+template<> uint16_t cast_normalized(float x) { return f32_to_bf16(x); }
+
+template<typename SrcT, typename DstT>
+void normalizeRow_fallback(const SrcT in[], DstT out[], float mean, float scale, int length) {
+    for (int l = 0; l < length; l++) {
+        out[l] = cast_normalized<DstT>((static_cast<float>(in[l]) - mean) * scale);
+    }
+}
+
+// U8 and FP32 inputs have vectored versions
+template<typename SrcT, typename DstT>
+void normalizeRow_simd(const SrcT in[], DstT out[], float mean, float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::normalizeRow(in, out, mean, scale, length);
+    return;
+    #endif  // HAVE_NEON
+
+    normalizeRow_fallback(in, out, mean, scale, length);
+}
+
+template<typename DstT>
+void normalizePlaneRow(const cv::gapi::fluid::View& src, DstT out[], float mean, float scale, int length) {
+    switch (src.meta().depth) {
+    case CV_8U:  normalizeRow_simd(src.InLine<uint8_t>(0), out, mean, scale, length); break;
+    case CV_32F: normalizeRow_simd(src.InLine<float>(0), out, mean, scale, length); break;
+    case CV_16U: normalizeRow_fallback(src.InLine<uint16_t>(0), out, mean, scale, length); break;
+    default: GAPI_Assert(!"not supported depth");
+    }
+}
+
+}  // namespace
+
+// Mean/scale normalization fused with the precision conversion, so the network input
+// is written once in its final precision and layout
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, int /*depth*/, float mean, float scale,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto length = dst.length();
+        switch (dst.meta().depth) {
+        case CV_32F: normalizePlaneRow(src, dst.OutLine<float>(), mean, scale, length); break;
+        case CV_16S: normalizePlaneRow(src, dst.OutLine<uint16_t>(), mean, scale, length); break;
+        default: GAPI_Assert(!"not supported depth");
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2426,6 +2503,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalizePlane
         >();
 }
 
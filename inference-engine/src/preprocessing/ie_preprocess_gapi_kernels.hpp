@@ -152,7 +152,16 @@ namespace gapi {
         }
     };
 
+    // Computes (x - mean) * scale and converts result to FP32 (CV_32F) or BF16 (stored as CV_16S)
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, int, float, float)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, int depth, float /*mean*/, float /*scale*/) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(depth == CV_32F || depth == CV_16S);
 
+            return in.withDepth(depth);
+        }
+    };
 
     cv::gapi::GKernelPackage preprocKernels();
 
@@ -24,6 +24,7 @@
 
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #if defined(__GNUC__) && (__GNUC__ <= 5)
@@ -102,6 +103,16 @@ template<> inline Q0_16 convert_cast(double x) {
 template<> inline Q8_8 convert_cast(uchar x) { return x << 8; }
 template<> inline uchar convert_cast(Q8_8 x) { return x >> 8; }
 
+// BF16 value is stored as 16-bit integer, rounding is to nearest even
+static inline uint16_t f32_to_bf16(float x) {
+    uint32_t u = 0;
+    std::memcpy(&u, &x, sizeof(u));
+    if ((u & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>((u >> 16) | 0x0040);  // quiet NaN
+    }
+    return static_cast<uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+}
+
 template<typename DST, typename SRC> static inline DST checked_cast(SRC x) {
     short dx = static_cast<DST>(x);
     GAPI_Assert(x == dx);  // check
@@ -787,6 +787,65 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+//------------------------------------------------------------------------------
+
+// Normalization (x - mean) * scale with conversion to FP32 or BF16
+
+#if MANUAL_SIMD
+static inline v_float32 vx_load_f32(const uint8_t* in) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(in)));
+}
+
+static inline v_float32 vx_load_f32(const float* in) {
+    return vx_load(in);
+}
+
+static inline void vx_store_f32(float* out, const v_float32& x) {
+    vx_store(out, x);
+}
+
+// see f32_to_bf16 for the scalar version
+static inline void vx_store_f32(uint16_t* out, const v_float32& x) {
+    const v_uint32 u = v_reinterpret_as_u32(x);
+    const v_uint32 rounded = (u + vx_setall_u32(0x7FFF) + ((u >> 16) & vx_setall_u32(1))) >> 16;
+    const v_uint32 nan = (u >> 16) | vx_setall_u32(0x0040);
+    const v_uint32 r = v_select(v_reinterpret_as_u32(x != x), nan, rounded);
+    v_store_low(out, v_pack(r, r));
+}
+
+template<typename SrcT, typename DstT>
+void normalizeRow_impl(const SrcT in[], DstT out[], const v_float32& mean, const v_float32& scale, int l) {
+    vx_store_f32(&out[l], (vx_load_f32(&in[l]) - mean) * scale);
+}
+#endif
+
+static inline void store_f32(float* out, float x) { *out = x; }
+static inline void store_f32(uint16_t* out, float x) { *out = f32_to_bf16(x); }
+
+template<typename SrcT, typename DstT>
+inline void normalizeRow_impl(const SrcT in[], DstT out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        normalizeRow_impl(in, out, vmean, vscale, l);
+    }
+
+    if (l < length && length >= nlanes) {
+        normalizeRow_impl(in, out, vmean, vscale, length - nlanes);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        store_f32(&out[l], (static_cast<float>(in[l]) - mean) * scale);
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
@@ -9,6 +9,7 @@
 #include <unordered_set>
 #include <algorithm>
 #include <deque>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -22,9 +23,11 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
 
 #include <cpp/ie_cnn_network.h>
+#include "ie_mmap_blob.hpp"
 #include "ie_blob_stream.hpp"
 #include "caseless.hpp"
 #include <ie_ngraph_utils.hpp>
@@ -441,6 +444,10 @@ public:
         TBlob<uint8_t>(weights->getTensorDesc(),
                        weights->cbuffer().as<uint8_t*>()),
         originBlob(weights) { }
+
+    WeightsHolderBlob(const Blob::CPtr& weights, const TensorDesc& desc, size_t offset) :
+        TBlob<uint8_t>(desc, weights->cbuffer().as<uint8_t*>() + offset),
+        originBlob(weights) { }
 };
 
 V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
@@ -464,7 +471,8 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const Blob::CPtr& weights) {
     std::shared_ptr<ngraph::Function> function;
-    XmlDeserializer visitor(root, weights, opsets);
+    XmlDeserializer::WeightsRanges sharedWeights;
+    XmlDeserializer visitor(root, weights, opsets, sharedWeights);
     visitor.on_attribute("net", function);
 
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "ConstructCNNNetwork");
@@ -663,6 +671,59 @@ bool V10Parser::LayerBaseCreator::shouldCreate(const std::string& nodeType) cons
     return comparator(nodeType, type);
 }
 
+std::shared_ptr<ngraph::Node> V10Parser::XmlDeserializer::createConstant(const pugi::xml_node& node,
+                                                                       const Blob::CPtr& weights,
+                                                                       const GenericLayerParams& params) {
+    auto dn = node.child("data");
+    if (dn.empty())
+        THROW_IE_EXCEPTION << "No attrtibutes defined for " << params.type << " op!";
+
+    std::string el_type_str;
+    std::vector<size_t> shape;
+    if (!getStrAttribute(dn, "element_type", el_type_str) || !getParameters<size_t>(dn, "shape", shape))
+        THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer " << params.name << " id:" << params.layerId
+                           << ": element_type and shape attributes are required";
+    auto el_type = details::convertPrecision(el_type_str);
+    size_t offset = GetUInt64Attr(dn, "offset");
+    size_t size = GetUInt64Attr(dn, "size");
+
+    size_t length = weights ? weights->byteSize() : 0;
+    if (!length)
+        THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+    if (length < offset + size)
+        THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << params.type << " op!";
+
+    const char* data = weights->cbuffer().as<const char*>() + offset;
+
+    // Only the weights which own their memory are referenced, a caller may release memory of other blobs
+    // after the network is read (e.g. the model read from memory by the Python API).
+    // Equal data of several Constants may be stored once, such data is copied, so a plugin which writes
+    // to the data of one Constant (e.g. through legacy weights blobs) does not change the others.
+    // IR writers do not align the data, ngraph and plugins read elements of the Constant type, so only
+    // the data which is not aligned to the element size is copied.
+    bool overlaps = false;
+    auto next = sharedWeights.lower_bound(offset);
+    if (next != sharedWeights.end() && next->first < offset + size)
+        overlaps = true;
+    if (next != sharedWeights.begin() && std::prev(next)->second > offset)
+        overlaps = true;
+    const size_t alignment = std::max<size_t>(el_type.size(), 1);
+    if (!weights->is<details::WeightsFileBlob>() || overlaps || reinterpret_cast<uintptr_t>(data) % alignment != 0)
+        return std::make_shared<ngraph::op::v0::Constant>(el_type, ngraph::Shape(shape), data);
+    if (size > 0)
+        sharedWeights.emplace(offset, offset + size);
+
+    // Weights may be a memory mapped file, in this case pages are loaded on the first access and
+    // shared with other processes which read the same model. The mapping is private, so writes to
+    // the data never reach the file. The file must not be truncated while the network exists.
+    Blob::CPtr weightsHolder = weights;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(
+        const_cast<char*>(data), size, weightsHolder);
+    return std::make_shared<ngraph::op::v0::Constant>(el_type, ngraph::Shape(shape), buffer);
+}
+
 std::shared_ptr<ngraph::Node> V10Parser::XmlDeserializer::createNode(
                                                     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
                                                     const pugi::xml_node& node,
@@ -713,18 +774,22 @@ std::shared_ptr<ngraph::Node> V10Parser::XmlDeserializer::createNode(
             }
         }
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
-        if (!ngraphNode) {
-            THROW_IE_EXCEPTION << "Opset " << params.version << " doesn't contain the operation with type: " << type;
-        }
-        ngraphNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, opsets);
-        if (ngraphNode->visit_attributes(visitor)) {
-            ngraphNode->constructor_validate_and_infer_types();
-        }
+        if (type == "Constant" && opset.contains_type<ngraph::op::v0::Constant>()) {
+            ngraphNode = createConstant(node, weights, params);
+        } else {
+            ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
+            if (!ngraphNode) {
+                THROW_IE_EXCEPTION << "Opset " << params.version << " doesn't contain the operation with type: " << type;
+            }
+            ngraphNode->set_arguments(inputs);
+            XmlDeserializer visitor(node, weights, opsets, sharedWeights);
+            if (ngraphNode->visit_attributes(visitor)) {
+                ngraphNode->constructor_validate_and_infer_types();
+            }
 
-        // To be sure that all default values will be initialized:
-        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+            // To be sure that all default values will be initialized:
+            ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+        }
 
         // Constructor of Loop and TensorIterator do not call validate_and_infer_types function
         // -> ticket 36145
@@ -762,8 +827,8 @@ std::shared_ptr<ngraph::Node> V10Parser::XmlDeserializer::createNode(
                 if (static_cast<uint64_t>(length) < offset + size)
                     THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer with name: " << params.name
                                        << ". Layer has incorrect weights!";
-                uint8_t* data = weights->cbuffer().as<uint8_t*>() + offset;
-                Blob::Ptr wBlob = make_shared_blob<uint8_t>({Precision::U8, { size / precision.size() }, C }, data);
+                Blob::Ptr wBlob = std::make_shared<WeightsHolderBlob>(
+                    weights, TensorDesc(Precision::U8, { size / precision.size() }, C), offset);
 
                 parameters[blob.name()] = wBlob;
             }
@@ -181,8 +181,12 @@ private:
 
     class XmlDeserializer : public ngraph::AttributeVisitor {
     public:
+        /// \brief Byte ranges of the weights referenced by Constants, the end of a range by its offset
+        using WeightsRanges = std::map<size_t, size_t>;
+
         explicit XmlDeserializer(const pugi::xml_node& node, const Blob::CPtr& weights,
-        const std::unordered_map<std::string, ngraph::OpSet>& opsets) : node(node), weights(weights), opsets(opsets) {}
+        const std::unordered_map<std::string, ngraph::OpSet>& opsets, WeightsRanges& sharedWeights) :
+            node(node), weights(weights), opsets(opsets), sharedWeights(sharedWeights) {}
         void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
             std::string val;
             if (!getStrAttribute(node.child("data"), name, val)) return;
@@ -288,6 +292,7 @@ private:
         const pugi::xml_node node;
         const Blob::CPtr& weights;
         const std::unordered_map<std::string, ngraph::OpSet>& opsets;
+        WeightsRanges& sharedWeights;
         /// \brief Traverses port_map in order to create vector of InputDescription shared_ptrs.
         /// Shall be used only for ops which have port_map attribute.
         /// \param node xml op representation
@@ -317,6 +322,16 @@ private:
         GenericLayerParams parseGenericParams(const pugi::xml_node& node);
         std::shared_ptr<ngraph::Node> createNode(const ngraph::OutputVector& inputs, const pugi::xml_node& node,
                                              const Blob::CPtr& weights, const GenericLayerParams& params);
+        /// \brief Creates Constant which references the weights memory instead of copying it.
+        /// The weights blob is kept alive by the Constant data buffer. The data is copied if the blob
+        /// does not own its memory, if the data is not aligned to the element size or if it overlaps
+        /// data of another Constant, so each Constant exclusively owns the bytes it references.
+        /// \param node xml node representation
+        /// \param weights weights blob
+        /// \param params generic layer parameters
+        /// \return shared pointer to the created Constant
+        std::shared_ptr<ngraph::Node> createConstant(const pugi::xml_node& node, const Blob::CPtr& weights,
+                                                     const GenericLayerParams& params);
 
         bool getStrAttribute(const pugi::xml_node& node, const std::string& name, std::string& value) {
             if (!node) return false;
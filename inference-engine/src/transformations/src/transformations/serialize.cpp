@@ -3,9 +3,11 @@
 //
 
 #include "itt.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -57,8 +59,71 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
+// Writes constant blobs to the .bin stream. Blobs with equal contents are written once and share
+// the offset, e.g. constants shared by layers of different subgraphs or duplicated by transformations.
+class ConstantWriter {
+public:
+    using FilePosition = int64_t;
+
+    explicit ConstantWriter(std::ostream& bin_data)
+        : m_bin_data(bin_data)
+        , m_blob_offset(std::max<FilePosition>(bin_data.tellp(), 0)) {
+    }
+
+    // Returns the offset of the blob in the stream. The data must stay valid until the writer is
+    // destroyed, it is compared with the next blobs of the same hash.
+    FilePosition write(const char* data, size_t size) {
+        if (size == 0) {
+            return m_blob_offset;
+        }
+        const size_t hash = hash_of(data, size);
+        const auto found = m_hash_to_blobs.equal_range(hash);
+        for (auto it = found.first; it != found.second; ++it) {
+            const Blob& blob = it->second;
+            if (blob.size == size && (blob.data == data || std::memcmp(blob.data, data, size) == 0)) {
+                return blob.offset;
+            }
+        }
+
+        const FilePosition offset = m_blob_offset;
+        m_hash_to_blobs.emplace(hash, Blob{data, size, offset});
+        m_bin_data.write(data, size);
+        m_blob_offset += size;
+        return offset;
+    }
+
+private:
+    struct Blob {
+        const char* data;
+        size_t size;
+        FilePosition offset;
+    };
+
+    // FNV-1a like hash over 8-byte words instead of bytes, so hashing stays cheap next to writing the data
+    static size_t hash_of(const char* data, size_t size) {
+        uint64_t hash = 14695981039346656037ULL ^ size;
+        const uint64_t prime = 1099511628211ULL;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+            // multiplication carries bits only upwards, fold the high bits back
+            hash ^= hash >> 29;
+        }
+        for (; i < size; i++) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+        }
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+
+    std::ostream& m_bin_data;
+    FilePosition m_blob_offset;
+    std::unordered_multimap<size_t, Blob> m_hash_to_blobs;
+};
+
 void ngfunction_2_irv10(pugi::xml_node& node,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets);
 
@@ -115,7 +180,7 @@ private:
 
 class XmlSerializer : public ngraph::AttributeVisitor {
     pugi::xml_node& m_xml_node;
-    std::ostream& m_bin_data;
+    ConstantWriter& m_constant_writer;
     std::string& m_node_type_name;
     const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
 
@@ -127,11 +192,11 @@ class XmlSerializer : public ngraph::AttributeVisitor {
 
 public:
     XmlSerializer(pugi::xml_node& data,
-                  std::ostream& bin_data,
+                  ConstantWriter& constant_writer,
                   std::string& node_type_name,
                   const std::map<std::string, ngraph::OpSet>& custom_opsets)
         : m_xml_node(data)
-        , m_bin_data(bin_data)
+        , m_constant_writer(constant_writer)
         , m_node_type_name(node_type_name)
         , m_custom_opsets(custom_opsets) {
     }
@@ -257,13 +322,11 @@ public:
                 ngraph::AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>;
             if (auto a = ngraph::as_type<AlignedBufferAdapter>(&adapter)) {
                 const int64_t size = a->size();
-                const int64_t offset = m_bin_data.tellp();
+                const int64_t offset = m_constant_writer.write(
+                    static_cast<const char*>(a->get_ptr()), static_cast<size_t>(size));
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
-
-                auto data = static_cast<const char*>(a->get_ptr());
-                m_bin_data.write(data, size);
             }
         }
     }
@@ -331,11 +394,11 @@ public:
             // to layer above (m_xml_node.parent()) as in ngfunction_2_irv10() layer (m_xml_node) with empty attributes
             // is removed.
             pugi::xml_node xml_body = m_xml_node.parent().append_child(name.c_str());
-            ngfunction_2_irv10(xml_body, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(xml_body, m_constant_writer, *adapter.get(), m_custom_opsets);
             xml_body.remove_attribute("name");
             xml_body.remove_attribute("version");
         } else if (name == "net") {
-            ngfunction_2_irv10(m_xml_node, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(m_xml_node, m_constant_writer, *adapter.get(), m_custom_opsets);
         } else {
             NGRAPH_CHECK(false, "Unsupported Function name.");
         }
@@ -569,7 +632,7 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
 }
 
 void ngfunction_2_irv10(pugi::xml_node& netXml,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
@@ -607,7 +670,7 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         if (exec_graph) {
             visit_exec_graph_node(data, node_type_name, node);
         } else {
-            XmlSerializer visitor(data, bin_file, node_type_name, custom_opsets);
+            XmlSerializer visitor(data, constant_writer, node_type_name, custom_opsets);
             NGRAPH_CHECK(node->visit_attributes(visitor),
                          "Visitor API is not supported in ", node);
             rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
@@ -718,7 +781,8 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 std::string name = "net";
                 pugi::xml_document xml_doc;
                 pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-                XmlSerializer visitor(net_node, bin_file, name, m_custom_opsets);
+                ConstantWriter constant_writer(bin_file);
+                XmlSerializer visitor(net_node, constant_writer, name, m_custom_opsets);
                 visitor.on_attribute(name, f);
 
                 xml_doc.save(xml_file);
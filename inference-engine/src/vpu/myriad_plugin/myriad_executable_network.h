@@ -85,6 +85,7 @@ public:
                                                                     _graphMetaData.stagesMeta, _config, _log,
                                                                     _executor);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        syncRequestImpl->setSharedPreProcessGraphCache(_preProcGraphCache);
         auto taskExecutorGetResult = getNextTaskExecutor();
         auto asyncThreadSafeImpl = std::make_shared<MyriadAsyncInferRequest>(
                 syncRequestImpl, _taskExecutor, _callbackExecutor, taskExecutorGetResult);
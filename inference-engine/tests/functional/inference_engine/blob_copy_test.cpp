@@ -287,8 +287,9 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
         1, 3,
 };
 
+// 3 channels are copied by SSE4.2 primitives, 16 channels by AVX2/AVX-512 transpose blocks
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        3, 7, 16,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -297,9 +298,10 @@ std::vector<Dims> BlobCopy_Dims = {
 };
 
 //  The 'blob_copy(4/5)_d' function is a template with the parameter-list  <InferenceEngine::Precision::ePrecision PRC>
+//  I64 is used for cases with the following accuracy:  I64, U64, FP64
 //  FP32 is used for cases with the following accuracy:  FP32, I32, U32
-//  FP16 is used for cases with the following accuracy:  FP16, U16, I16
-//  U8 is used for cases with the following accuracy:  U8, I8
+//  FP16 is used for cases with the following accuracy:  FP16, BF16, U16, I16
+//  U8 is used for cases with the following accuracy:  U8, I8, BOOL
 //  Cases with other precision are not supported
 std::vector<PrecisionType> BlobCopy_PrecisionParams = {
         InferenceEngine::Precision::FP32,
@@ -310,6 +312,9 @@ std::vector<PrecisionType> BlobCopy_PrecisionParams = {
         InferenceEngine::Precision::I16,
         InferenceEngine::Precision::U32,
         InferenceEngine::Precision::I32,
+        InferenceEngine::Precision::I64,
+        InferenceEngine::Precision::U64,
+        InferenceEngine::Precision::FP64,
 };
 
 }  // namespace
@@ -322,6 +327,33 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopyTest,
                            ::testing::ValuesIn(BlobCopy_Dims),
                            ::testing::ValuesIn(BlobCopy_PrecisionParams)));
 
+// Micro-benchmarks of large blobs: 4K frames, feature maps and batched video clips.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*perf* to print execution times
+INSTANTIATE_TEST_CASE_P(DISABLED_perf_4K, BlobCopyTest,
+                        ::testing::Combine(::testing::Values(true, false),
+                           ::testing::Values(true, false),
+                           ::testing::Values(1),
+                           ::testing::Values(3, 4),
+                           ::testing::Values(Dims{2160, 3840}),
+                           ::testing::Values(InferenceEngine::Precision::U8, InferenceEngine::Precision::FP32)));
+
+INSTANTIATE_TEST_CASE_P(DISABLED_perf_features, BlobCopyTest,
+                        ::testing::Combine(::testing::Values(true, false),
+                           ::testing::Values(true, false),
+                           ::testing::Values(1, 8),
+                           ::testing::Values(64),
+                           ::testing::Values(Dims{56, 56}, Dims{224, 224}),
+                           ::testing::Values(InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP16,
+                                             InferenceEngine::Precision::I64)));
+
+INSTANTIATE_TEST_CASE_P(DISABLED_perf_video, BlobCopyTest,
+                        ::testing::Combine(::testing::Values(true, false),
+                           ::testing::Values(true, false),
+                           ::testing::Values(4),
+                           ::testing::Values(3),
+                           ::testing::Values(Dims{16, 224, 224}, Dims{16, 720, 1280}),
+                           ::testing::Values(InferenceEngine::Precision::U8, InferenceEngine::Precision::FP32)));
+
 namespace {
 
 template <typename T>
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ie_core.hpp"
+#include "ngraph/ngraph.hpp"
+#include "transformations/serialize.hpp"
+#include <ngraph/opsets/opset6.hpp>
+
+class ConstDeduplicationSerializationTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+};
+
+TEST_F(ConstDeduplicationSerializationTest, EqualConstantsShareBlob) {
+    InferenceEngine::Core ie;
+
+    std::shared_ptr<ngraph::Function> function;
+    {
+        const ngraph::Shape shape{2, 2};
+        auto parameter = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, shape);
+        auto const_a = ngraph::opset6::Constant::create(ngraph::element::f32, shape, {1, 2, 3, 4});
+        auto const_b = ngraph::opset6::Constant::create(ngraph::element::f32, shape, {1, 2, 3, 4});
+        auto const_c = ngraph::opset6::Constant::create(ngraph::element::f32, shape, {5, 6, 7, 8});
+        auto add = std::make_shared<ngraph::opset6::Add>(parameter, const_a);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, const_b);
+        auto sub = std::make_shared<ngraph::opset6::Subtract>(mul, const_c);
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{parameter});
+    }
+
+    InferenceEngine::CNNNetwork expected(function);
+    expected.serialize(m_out_xml_path, m_out_bin_path);
+
+    std::ifstream bin(m_out_bin_path, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(bin.good());
+    EXPECT_EQ(2 * 4 * sizeof(float), static_cast<size_t>(bin.tellg()));
+
+    auto result = ie.ReadNetwork(m_out_xml_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true);
+    ASSERT_TRUE(success) << message;
+}
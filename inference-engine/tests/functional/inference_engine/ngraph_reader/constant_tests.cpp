@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
+#include <fstream>
+#include <vector>
+#include <ngraph/opsets/opset1.hpp>
 #include <legacy/ie_util_internal.hpp>
+#include "ie_mmap_blob.hpp"
 #include "ngraph_reader_tests.hpp"
 
 using namespace InferenceEngine;
@@ -53,3 +58,221 @@ TEST_F(NGraphReaderTests, ReadConstantNetwork) {
 
         IE_SUPPRESS_DEPRECATED_END
 }
+
+namespace {
+
+const std::string constantNetworkModel = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant" type="Const" version="opset1">
+            <data element_type="f32" offset="16" shape="2,2" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+std::string getConstantNetworkModel(size_t offset) {
+    auto model = constantNetworkModel;
+    const std::string offsetAttr = "offset=\"16\"";
+    return model.replace(model.find(offsetAttr), offsetAttr.size(), "offset=\"" + std::to_string(offset) + "\"");
+}
+
+// Weights which own their memory as the weights read from a file
+Blob::Ptr makeWeightsFileBlob() {
+    Blob::Ptr buffer = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {128}, Layout::C));
+    buffer->allocate();
+    return std::make_shared<InferenceEngine::details::WeightsFileBlob>(buffer, buffer->buffer().as<uint8_t*>(), buffer->byteSize());
+}
+
+// Offset of the first 64 bytes aligned address of the weights
+size_t getAlignedOffset(const Blob::Ptr& weights) {
+    auto address = reinterpret_cast<uintptr_t>(weights->cbuffer().as<const uint8_t*>());
+    return (64 - address % 64) % 64;
+}
+
+// Writes 0, 1, 2, 3 at the offset of the weights
+float* fillWeights(const Blob::Ptr& weights, size_t offset) {
+    auto data = reinterpret_cast<float*>(weights->buffer().as<uint8_t*>() + offset);
+    for (size_t i = 0; i < 4; i++)
+        data[i] = static_cast<float>(i);
+    return data;
+}
+
+std::shared_ptr<ngraph::opset1::Constant> getConstant(const CNNNetwork& network) {
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(op))
+            return constant;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkSharesAlignedWeightsMemory) {
+    Core ie;
+    Blob::Ptr weights = makeWeightsFileBlob();
+    // the data aligned to the element size is enough
+    auto offset = getAlignedOffset(weights) + sizeof(float);
+    auto weightsData = fillWeights(weights, offset);
+
+    auto network = ie.ReadNetwork(getConstantNetworkModel(offset), weights);
+    auto constant = getConstant(network);
+    ASSERT_NE(nullptr, constant);
+    ASSERT_EQ(weightsData, constant->get_data_ptr<float>());
+
+    // constant keeps weights alive
+    weights.reset();
+    ASSERT_EQ(std::vector<float>({0.f, 1.f, 2.f, 3.f}), constant->cast_vector<float>());
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkCopiesMisalignedWeights) {
+    Core ie;
+    Blob::Ptr weights = makeWeightsFileBlob();
+    auto offset = getAlignedOffset(weights) + sizeof(float) / 2;
+    auto weightsData = fillWeights(weights, offset);
+
+    auto network = ie.ReadNetwork(getConstantNetworkModel(offset), weights);
+    auto constant = getConstant(network);
+    ASSERT_NE(nullptr, constant);
+    ASSERT_NE(weightsData, constant->get_data_ptr<float>());
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % sizeof(float));
+    ASSERT_EQ(std::vector<float>({0.f, 1.f, 2.f, 3.f}), constant->cast_vector<float>());
+}
+
+// Memory of the weights passed by the caller may be released after the network is read
+TEST_F(NGraphReaderTests, ReadConstantNetworkCopiesNotOwnedWeights) {
+    Core ie;
+    std::vector<uint8_t> memory(128);
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {memory.size()}, Layout::C), memory.data());
+    auto offset = getAlignedOffset(weights);
+    auto weightsData = fillWeights(weights, offset);
+
+    auto network = ie.ReadNetwork(getConstantNetworkModel(offset), weights);
+    auto constant = getConstant(network);
+    ASSERT_NE(nullptr, constant);
+    ASSERT_NE(weightsData, constant->get_data_ptr<float>());
+
+    weights.reset();
+    std::fill(memory.begin(), memory.end(), 0);
+    ASSERT_EQ(std::vector<float>({0.f, 1.f, 2.f, 3.f}), constant->cast_vector<float>());
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkCopiesWeightsOfDeduplicatedConstants) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant_a" type="Const" version="opset1">
+            <data element_type="f32" offset="OFFSET" shape="2,2" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="constant_b" type="Const" version="opset1">
+            <data element_type="f32" offset="OFFSET" shape="2,2" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights = makeWeightsFileBlob();
+    auto offset = getAlignedOffset(weights);
+    fillWeights(weights, offset);
+
+    std::string offsetStr = std::to_string(offset);
+    for (auto pos = model.find("OFFSET"); pos != std::string::npos; pos = model.find("OFFSET"))
+        model.replace(pos, 6, offsetStr);
+
+    // the data stored once is referenced by one Constant and copied for the other
+    auto network = ie.ReadNetwork(model, weights);
+    std::vector<std::shared_ptr<ngraph::opset1::Constant>> constants;
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(op))
+            constants.push_back(constant);
+    }
+    ASSERT_EQ(2u, constants.size());
+    ASSERT_NE(constants[0]->get_data_ptr(), constants[1]->get_data_ptr());
+    ASSERT_EQ(constants[0]->cast_vector<float>(), constants[1]->cast_vector<float>());
+    ASSERT_EQ(std::vector<float>({0.f, 1.f, 2.f, 3.f}), constants[0]->cast_vector<float>());
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkFromFiles) {
+    const std::string xmlPath = "ReadConstantNetworkFromFiles.xml";
+    const std::string binPath = "ReadConstantNetworkFromFiles.bin";
+    CommonTestUtils::createFile(xmlPath, constantNetworkModel);
+    {
+        std::ofstream binFile(binPath, std::ios::binary);
+        for (size_t i = 0; i < 8; i++) {
+            float value = static_cast<float>(i);
+            binFile.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+    }
+
+    std::vector<float> values;
+    {
+        Core ie;
+        auto network = ie.ReadNetwork(xmlPath);
+        auto constant = getConstant(network);
+        ASSERT_NE(nullptr, constant);
+        values = constant->cast_vector<float>();
+    }
+    CommonTestUtils::removeIRFiles(xmlPath, binPath);
+    ASSERT_EQ(std::vector<float>({4.f, 5.f, 6.f, 7.f}), values);
+}
@@ -186,6 +186,65 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, highPriorityTasksAreStartedFirst) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isBlocked = true;
+    std::vector<int> order;
+
+    // the only stream is busy, so all the following tasks are pending
+    auto blocker = async(taskExecutor, [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&isBlocked] { return !isBlocked; });
+    });
+
+    std::vector<Future> futures;
+    auto push = [&] (int id, IStreamsExecutor::TaskPriority priority) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, id] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        });
+        futures.emplace_back(p->get_future());
+        taskExecutor->run([p] {(*p)();}, priority);
+    };
+    push(0, IStreamsExecutor::TaskPriority::LOW);
+    push(1, IStreamsExecutor::TaskPriority::NORMAL);
+    push(2, IStreamsExecutor::TaskPriority::HIGH);
+    push(3, IStreamsExecutor::TaskPriority::LOW);
+    push(4, IStreamsExecutor::TaskPriority::HIGH);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isBlocked = false;
+    }
+    cv.notify_all();
+    blocker.wait();
+    for (auto&& f : futures) f.wait();
+
+    ASSERT_EQ((std::vector<int>{2, 4, 1, 0, 3}), order);
+}
+
+TEST(CPUStreamsExecutorTests, canRunManyTasksOfDifferentPrioritiesFromMultipleThreads) {
+    std::atomic_int sharedVar = {0};
+    const int THREAD_NUMBER = 8;
+    const int NUM_TASKS = 2000;
+    {
+        CPUStreamsExecutor taskExecutor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 4, 1}};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < THREAD_NUMBER; i++) {
+            threads.emplace_back([&] {
+                for (int k = 0; k < NUM_TASKS; k++) {
+                    taskExecutor.run([&] {++sharedVar;}, static_cast<IStreamsExecutor::TaskPriority>(k % 3));
+                }
+            });
+        }
+        for (auto&& thread : threads) thread.join();
+    }
+    // executor destructor waits for all the pending tasks
+    ASSERT_EQ(THREAD_NUMBER * NUM_TASKS, sharedVar);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
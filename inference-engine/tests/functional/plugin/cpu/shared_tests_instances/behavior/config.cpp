@@ -24,7 +24,12 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INFER_PRIORITY, InferenceEngine::PluginConfigParams::CPU_PRIORITY_HIGH}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INFER_PRIORITY, InferenceEngine::PluginConfigParams::CPU_PRIORITY_LOW}},
+            {{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES},
+                    {InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY, "100"}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +64,10 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_INFER_PRIORITY, "URGENT"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
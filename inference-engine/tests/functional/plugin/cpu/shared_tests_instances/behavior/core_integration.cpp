@@ -25,6 +25,10 @@ INSTANTIATE_TEST_CASE_P(
         smoke_IEClassImportExportTestP, IEClassImportExportTestP,
         ::testing::Values("HETERO:CPU"));
 
+INSTANTIATE_TEST_CASE_P(
+        smoke_IEClassNetworkCacheTestP, IEClassNetworkCacheTestP,
+        ::testing::Values("CPU"));
+
 //
 // IE Class GetMetric
 //
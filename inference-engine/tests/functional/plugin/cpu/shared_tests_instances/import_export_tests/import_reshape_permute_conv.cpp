@@ -0,0 +1,72 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_reshape_permute_conv.hpp"
+
+#include <fstream>
+#include <stdio.h>
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+class ImportReshapePermuteConvCPU : public ImportReshapePermuteConv {
+private:
+    void exportImportNetwork() override {
+        executableNetwork.Export(fileName);
+        executableNetwork = core->ImportNetwork(fileName, targetDevice, configuration);
+    }
+protected:
+    void TearDown() override {
+        if (remove(fileName.c_str()) != 0) {
+            FAIL() << "Error: could not delete file " << fileName;
+        }
+    }
+
+private:
+    std::string fileName = "exported_model_cpu.blob";
+};
+
+TEST_P(ImportReshapePermuteConvCPU, CompareWithRefImpl) {
+    Run();
+};
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32
+};
+
+const std::vector<std::map<std::string, std::string>> exportConfigs = {
+    {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_EXPORTABLE, InferenceEngine::PluginConfigParams::YES}
+    },
+    {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_EXPORTABLE, InferenceEngine::PluginConfigParams::YES},
+        {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}
+    }
+};
+
+const std::vector<std::map<std::string, std::string>> importConfigs = {
+    {},
+    {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkCase, ImportReshapePermuteConv,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::ValuesIn(exportConfigs),
+                            ::testing::ValuesIn(importConfigs)),
+                        ImportReshapePermuteConv::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkFileCase, ImportReshapePermuteConvCPU,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::ValuesIn(exportConfigs),
+                            ::testing::ValuesIn(importConfigs)),
+                        ImportReshapePermuteConvCPU::getTestCaseName);
+
+} // namespace
@@ -0,0 +1,15 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_scheduling_policy_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_names_for_scheduling_policy {
+        {CPU},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SchedulingPolicyMultiCPU, MultiDevice_Test,
+        ::testing::ValuesIn(device_names_for_scheduling_policy), MultiDevice_Test::getTestCaseName);
@@ -0,0 +1,214 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/ngraph.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+static constexpr size_t channels = 4;
+
+// Computes relu(x * (c + 1) - 1) for the channel c of the input [1, channels, length]
+static std::shared_ptr<ngraph::Function> makeScaleShift(size_t length) {
+    using namespace ngraph;
+    std::vector<float> scales(channels);
+    for (size_t c = 0; c < channels; c++)
+        scales[c] = static_cast<float>(c + 1);
+
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, channels, length});
+    auto scale = std::make_shared<op::v0::Constant>(element::f32, Shape{1, channels, 1}, scales);
+    auto shift = std::make_shared<op::v0::Constant>(element::f32, Shape{1, channels, 1}, std::vector<float>(channels, -1.f));
+    auto multiply = std::make_shared<op::v1::Multiply>(input, scale);
+    auto add = std::make_shared<op::v1::Add>(multiply, shift);
+    auto relu = std::make_shared<op::v0::Relu>(add);
+
+    return std::make_shared<Function>(NodeVector{relu}, ParameterVector{input}, "ScaleShift");
+}
+
+// Chain of convolutions with ReLU for the input [1, 16, length, length]
+static std::shared_ptr<ngraph::Function> makeConvolutions(size_t length) {
+    using namespace ngraph;
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, length, length});
+    Output<Node> output = input;
+    for (size_t i = 0; i < 4; i++) {
+        auto conv = builder::makeConvolution(output, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        output = std::make_shared<op::v0::Relu>(conv);
+    }
+    return std::make_shared<Function>(OutputVector{output}, ParameterVector{input}, "Convolutions");
+}
+
+// Conv -> ReLU -> SE block: the channels are scaled by sigmoid of convolutions of the spatial mean
+static std::shared_ptr<ngraph::Function> makeSqueezeExcitation(size_t length) {
+    using namespace ngraph;
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, length, length});
+    auto conv = builder::makeConvolution(input, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                         op::PadType::EXPLICIT, 16);
+    auto relu = std::make_shared<op::v0::Relu>(conv);
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto mean = std::make_shared<op::v1::ReduceMean>(relu, axes, true);
+    auto squeeze = builder::makeConvolution(mean, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                            op::PadType::EXPLICIT, 4);
+    auto squeezeRelu = std::make_shared<op::v0::Relu>(squeeze);
+    auto excite = builder::makeConvolution(squeezeRelu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                           op::PadType::EXPLICIT, 16);
+    auto scale = std::make_shared<op::v0::Sigmoid>(excite);
+    auto multiply = std::make_shared<op::v1::Multiply>(relu, scale);
+    return std::make_shared<Function>(OutputVector{multiply}, ParameterVector{input}, "SqueezeExcitation");
+}
+
+static int64_t elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Sequences of different lengths are inferred by the same request, the number of distinct lengths
+// exceeds the cache size, so graphs are evicted and created again
+TEST(DynamicShapesTest, inferMixedSequenceLengths) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeScaleShift(16));
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES},
+                                    {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "2"}});
+    auto request = execNet.CreateInferRequest();
+
+    for (size_t length : {16, 7, 33, 7, 1, 16, 64, 33, 7}) {
+        auto input = make_shared_blob<float>({Precision::FP32, {1, channels, length}, Layout::CHW});
+        input->allocate();
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = static_cast<float>(i % 5) * 0.5f;
+        request.SetBlob(inputName, input);
+
+        request.Infer();
+
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ(input->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t c = 0; c < channels; c++) {
+            for (size_t i = 0; i < length; i++) {
+                const float expected = std::max(0.f, inputData[c * length + i] * (c + 1) - 1.f);
+                ASSERT_FLOAT_EQ(expected, outputData[c * length + i]);
+            }
+        }
+    }
+}
+
+// Results of the compiled network reinitialized for new spatial dims are compared with the network
+// reshaped for these dims
+static void compareWithReshaped(const std::shared_ptr<ngraph::Function> &function, const std::vector<size_t> &lengths) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+    for (auto length : lengths) {
+        const SizeVector dims{1, 16, length, length};
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, dims, Layout::NCHW});
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        // the weights are random, so the reference takes them from the same function
+        auto reshaped = ngraph::clone_function(*function);
+        reshaped->get_parameters()[0]->set_partial_shape(ngraph::Shape(dims));
+        reshaped->validate_nodes_and_infer_types();
+        auto reshapedExecNet = ie->LoadNetwork(CNNNetwork(reshaped), CommonTestUtils::DEVICE_CPU);
+        auto reshapedRequest = reshapedExecNet.CreateInferRequest();
+        reshapedRequest.SetBlob(inputName, input);
+        reshapedRequest.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), reshapedRequest.GetBlob(outputName));
+    }
+}
+
+TEST(DynamicShapesTest, convolutionsWithNewSpatialDims) {
+    compareWithReshaped(makeConvolutions(32), {48, 17, 32, 48});
+}
+
+// The average pooling made of ReduceMean has the kernel of the whole spatial dims
+TEST(DynamicShapesTest, squeezeExcitationWithNewSpatialDims) {
+    compareWithReshaped(makeSqueezeExcitation(32), {48, 17, 32, 1});
+}
+
+// Reports latency of the first inference with new input dims, which reinitializes the compiled network,
+// of the next inference with the cached graph and of LoadNetwork of the network reshaped for these dims
+TEST(DynamicShapesTest, DISABLED_newShapeLatency) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeConvolutions(32));
+    const auto inputName = network.getInputsInfo().begin()->first;
+
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+    request.Infer();
+
+    request.SetBlob(inputName, FuncTestUtils::createAndFillBlob({Precision::FP32, {1, 16, 48, 48}, Layout::NCHW}));
+    auto start = std::chrono::steady_clock::now();
+    request.Infer();
+    RecordProperty("NewShapeInferUs", static_cast<int>(elapsedUs(start)));
+    start = std::chrono::steady_clock::now();
+    request.Infer();
+    RecordProperty("CachedShapeInferUs", static_cast<int>(elapsedUs(start)));
+
+    CNNNetwork staticNetwork(makeConvolutions(48));
+    start = std::chrono::steady_clock::now();
+    ie->LoadNetwork(staticNetwork, CommonTestUtils::DEVICE_CPU);
+    RecordProperty("LoadNetworkUs", static_cast<int>(elapsedUs(start)));
+}
+
+// Output blobs set by the user are reshaped for the new dims, the inference throws if they are too small
+TEST(DynamicShapesTest, reshapesUserOutputBlob) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeScaleShift(16));
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+    auto output = make_shared_blob<float>({Precision::FP32, {1, channels, 16}, Layout::CHW});
+    output->allocate();
+    request.SetBlob(outputName, output);
+
+    request.SetBlob(inputName, FuncTestUtils::createAndFillBlob({Precision::FP32, {1, channels, 8}, Layout::CHW}));
+    request.Infer();
+    ASSERT_EQ(output, request.GetBlob(outputName));
+    ASSERT_EQ((SizeVector{1, channels, 8}), output->getTensorDesc().getDims());
+
+    // the blob keeps its memory, so it is enough for the original dims again
+    request.SetBlob(inputName, FuncTestUtils::createAndFillBlob({Precision::FP32, {1, channels, 16}, Layout::CHW}));
+    request.Infer();
+    ASSERT_EQ((SizeVector{1, channels, 16}), output->getTensorDesc().getDims());
+
+    request.SetBlob(inputName, FuncTestUtils::createAndFillBlob({Precision::FP32, {1, channels, 17}, Layout::CHW}));
+    ASSERT_THROW(request.Infer(), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST(DynamicShapesTest, throwsWithDynamicBatch) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeScaleShift(16));
+    ASSERT_THROW(ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                 {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES},
+                                  {PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+class ImportExportTimeTest : public CommonTestUtils::TestsCommon {
+protected:
+    // Chain of FP16 convolutions, so the transformations convert and fold the weights
+    static CNNNetwork makeNetwork(size_t numConvolutions) {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 32, 56, 56});
+        ngraph::Output<ngraph::Node> output = input;
+        for (size_t i = 0; i < numConvolutions; i++) {
+            auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f16, {32, 32, 3, 3}, {}, true);
+            auto weightsF32 = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+            auto conv = std::make_shared<ngraph::opset1::Convolution>(output, weightsF32, ngraph::Strides{1, 1},
+                ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+            output = std::make_shared<ngraph::opset1::Relu>(conv);
+        }
+        auto result = std::make_shared<ngraph::opset1::Result>(output);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{input},
+                                                             "ImportExportTime"));
+    }
+
+    template <typename F>
+    static std::chrono::microseconds medianTime(size_t iterations, F&& f) {
+        std::vector<std::chrono::microseconds> times;
+        for (size_t i = 0; i < iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            times.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+        }
+        std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+        return times[times.size() / 2];
+    }
+
+    static Blob::Ptr infer(ExecutableNetwork& execNet, const Blob::Ptr& input) {
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(execNet.GetInputsInfo().begin()->first, input);
+        request.Infer();
+        return request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+    }
+};
+
+// The network is kept for export only if it is requested
+TEST_F(ImportExportTimeTest, exportRequiresExportableNetwork) {
+    auto ie = PluginCache::get().ie();
+    auto network = makeNetwork(1);
+
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    std::stringstream stream;
+    ASSERT_THROW(execNet.Export(stream), details::InferenceEngineException);
+
+    execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{PluginConfigParams::KEY_CPU_EXPORTABLE, PluginConfigParams::YES}});
+    ASSERT_NO_THROW(execNet.Export(stream));
+}
+
+// Sizes read from a truncated or corrupted stream are checked against its length before allocations
+TEST_F(ImportExportTimeTest, importThrowsOnCorruptedStream) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeNetwork(1), CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_EXPORTABLE, PluginConfigParams::YES}});
+    std::stringstream exported;
+    execNet.Export(exported);
+    const auto blob = exported.str();
+
+    std::istringstream truncated(blob.substr(0, blob.size() / 2));
+    ASSERT_THROW(ie->ImportNetwork(truncated, CommonTestUtils::DEVICE_CPU, {}), details::InferenceEngineException);
+
+    // the number of config items follows the format version and the transformed flag
+    auto corrupted = blob;
+    std::fill_n(corrupted.begin() + sizeof(uint32_t) + sizeof(uint8_t), sizeof(uint64_t), '\xff');
+    std::istringstream corruptedStream(corrupted);
+    ASSERT_THROW(ie->ImportNetwork(corruptedStream, CommonTestUtils::DEVICE_CPU, {}), details::InferenceEngineException);
+}
+
+// Reports median times of LoadNetwork and ImportNetwork of the network exported after the common transformations,
+// import repeats the rest of the compilation
+TEST_F(ImportExportTimeTest, loadVsImport) {
+    constexpr size_t iterations = 5;
+    auto ie = PluginCache::get().ie();
+    auto network = makeNetwork(16);
+    const std::map<std::string, std::string> config{{PluginConfigParams::KEY_CPU_EXPORTABLE, PluginConfigParams::YES}};
+
+    ExecutableNetwork loaded;
+    auto loadTime = medianTime(iterations, [&] {
+        loaded = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    });
+
+    std::stringstream exported;
+    loaded.Export(exported);
+    const auto blob = exported.str();
+
+    ExecutableNetwork imported;
+    auto importTime = medianTime(iterations, [&] {
+        std::istringstream stream(blob);
+        imported = ie->ImportNetwork(stream, CommonTestUtils::DEVICE_CPU, {});
+    });
+
+    RecordProperty("LoadNetworkUs", static_cast<int>(loadTime.count()));
+    RecordProperty("ImportNetworkUs", static_cast<int>(importTime.count()));
+    RecordProperty("ExportedBytes", static_cast<int>(blob.size()));
+
+    auto input = FuncTestUtils::createAndFillBlob(loaded.GetInputsInfo().begin()->second->getTensorDesc());
+    auto expected = infer(loaded, input);
+    auto actual = infer(imported, input);
+    FuncTestUtils::compareBlobs(actual, expected);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
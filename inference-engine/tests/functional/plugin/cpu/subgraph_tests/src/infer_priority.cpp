@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/ngraph.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+// Chain of convolutions which takes a few milliseconds, so requests stay pending while the stream is busy
+static std::shared_ptr<ngraph::Function> makeConvolutions() {
+    using namespace ngraph;
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 32, 64, 64});
+    Output<Node> output = input;
+    for (size_t i = 0; i < 4; i++) {
+        auto conv = builder::makeConvolution(output, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 32);
+        output = std::make_shared<op::v0::Relu>(conv);
+    }
+    return std::make_shared<Function>(OutputVector{output}, ParameterVector{input}, "Convolutions");
+}
+
+// Networks loaded with the priority share the single stream, the request of the latency critical network
+// started after the bulk requests completes before the pending bulk requests
+TEST(InferPriorityTest, highPriorityRequestOvertakesPendingLowPriorityRequests) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeConvolutions());
+    auto loadNetwork = [&] (const std::string& priority) {
+        return ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                               {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"},
+                                {PluginConfigParams::KEY_CPU_INFER_PRIORITY, priority}});
+    };
+    auto bulkNet = loadNetwork(PluginConfigParams::CPU_PRIORITY_LOW);
+    auto latencyNet = loadNetwork(PluginConfigParams::CPU_PRIORITY_HIGH);
+
+    constexpr int numBulkRequests = 8;
+    constexpr int latencyRequestId = numBulkRequests;
+    std::mutex mutex;
+    std::vector<int> completionOrder;
+    auto track = [&] (InferRequest& request, int id) {
+        request.SetCompletionCallback([&, id] {
+            std::lock_guard<std::mutex> lock{mutex};
+            completionOrder.push_back(id);
+        });
+    };
+
+    std::vector<InferRequest> bulkRequests;
+    for (int i = 0; i < numBulkRequests; i++) {
+        bulkRequests.push_back(bulkNet.CreateInferRequest());
+        track(bulkRequests.back(), i);
+    }
+    auto latencyRequest = latencyNet.CreateInferRequest();
+    track(latencyRequest, latencyRequestId);
+
+    for (auto&& request : bulkRequests)
+        request.StartAsync();
+    latencyRequest.StartAsync();
+
+    ASSERT_EQ(StatusCode::OK, latencyRequest.Wait(IInferRequest::WaitMode::RESULT_READY));
+    for (auto&& request : bulkRequests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    std::lock_guard<std::mutex> lock{mutex};
+    ASSERT_EQ(static_cast<size_t>(numBulkRequests + 1), completionOrder.size());
+    auto position = std::find(completionOrder.begin(), completionOrder.end(), latencyRequestId) - completionOrder.begin();
+    // the first bulk request may already run when the latency critical request is started
+    ASSERT_LE(position, 1);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Input shape
+        size_t,                 // Number of branches
+        std::string,            // Inter-op parallel mode
+        std::string             // Device name
+> InterOpParallelTuple;
+
+// Split -> N branches of different depth -> Concat. Branches are independent, so with inter-op mode enabled
+// they are executed concurrently and intermediate tensors of different branches are alive at the same time.
+class InterOpParallelTest : public testing::WithParamInterface<InterOpParallelTuple>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelTuple> &obj) {
+        std::vector<size_t> inputShape;
+        size_t branches;
+        std::string interOp;
+        std::string targetName;
+        std::tie(inputShape, branches, interOp, targetName) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Branches=" << branches << "_";
+        results << "InterOp=" << interOp << "_";
+        results << "targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        size_t branches;
+        std::string interOp;
+        std::tie(inputShape, branches, interOp, targetDevice) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_INTER_OP_PARALLEL, interOp});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto split = ngraph::builder::makeSplit(params[0], ngPrc, branches, 1);
+
+        ngraph::OutputVector concatInputs;
+        for (size_t i = 0; i < branches; i++) {
+            ngraph::Output<ngraph::Node> branch = split->output(i);
+            for (size_t depth = 0; depth <= i; depth++) {
+                auto conv = ngraph::builder::makeConvolution(branch, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                             ngraph::op::PadType::EXPLICIT, 4);
+                branch = std::make_shared<ngraph::opset1::Relu>(conv);
+            }
+            concatInputs.push_back(branch);
+        }
+        auto concat = std::make_shared<ngraph::opset1::Concat>(concatInputs, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat),
+                                     std::make_shared<ngraph::opset1::Result>(concatInputs.front().get_node_shared_ptr())};
+        function = std::make_shared<ngraph::Function>(results, params, "InterOpParallel");
+    }
+};
+
+TEST_P(InterOpParallelTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_InterOpParallel, InterOpParallelTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 8, 20, 20}),
+                                ::testing::Values(2, 4),
+                                ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        InterOpParallelTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
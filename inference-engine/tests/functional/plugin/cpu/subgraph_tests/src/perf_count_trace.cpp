@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/ngraph.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+static size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+        count++;
+    return count;
+}
+
+class PerfCountTraceTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string traceFile = GetTestName() + "_" + GetTimestamp() + ".json";
+
+    void TearDown() override {
+        std::remove(traceFile.c_str());
+    }
+};
+
+// Executions of all stream graphs are written into one trace on request only
+TEST_F(PerfCountTraceTest, traceOfAllStreamsIsWrittenOnRequest) {
+    auto ie = PluginCache::get().ie();
+    auto input = std::make_shared<ngraph::op::v0::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+    auto relu = std::make_shared<ngraph::op::v0::Relu>(input);
+    CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input}));
+
+    constexpr size_t numStreams = 2;
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {
+        {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(numStreams)},
+        {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES},
+        {PluginConfigParams::KEY_CPU_PERF_COUNT_HISTORY, "16"}});
+
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 2 * numStreams; i++)
+        requests.push_back(execNet.CreateInferRequest());
+    for (auto&& request : requests)
+        request.StartAsync();
+    for (auto&& request : requests) {
+        request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        request.GetPerformanceCounts();
+    }
+
+    // the performance counts do not write the trace as a side effect
+    ASSERT_FALSE(std::ifstream(traceFile).is_open());
+
+    execNet.SetConfig({{PluginConfigParams::KEY_CPU_PERF_COUNT_TRACE, traceFile}});
+    std::ifstream trace(traceFile);
+    ASSERT_TRUE(trace.is_open());
+    std::string content{std::istreambuf_iterator<char>(trace), std::istreambuf_iterator<char>()};
+
+    ASSERT_EQ(numStreams, countOccurrences(content, "\"process_name\""));
+    for (size_t stream = 0; stream < numStreams; stream++)
+        ASSERT_EQ(1u, countOccurrences(content, "(stream " + std::to_string(stream) + ")"));
+    ASSERT_LE(requests.size(), countOccurrences(content, "\"ph\": \"X\""));
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
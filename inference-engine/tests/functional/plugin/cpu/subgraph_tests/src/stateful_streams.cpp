@@ -0,0 +1,125 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/ngraph.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+// Accumulates the input in the state and returns the accumulated value
+static std::shared_ptr<ngraph::Function> makeAccumulator(const ngraph::Shape& shape) {
+    using namespace ngraph;
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto init = std::make_shared<op::v0::Constant>(element::f32, shape, 0);
+    auto read = std::make_shared<op::v3::ReadValue>(init, "acc");
+    auto add = std::make_shared<op::v1::Add>(read, input);
+    auto assign = std::make_shared<op::v3::Assign>(add, "acc");
+    auto relu = std::make_shared<op::v0::Relu>(add);
+
+    // WA. Limitation of ngraph. control_dependency are required.
+    assign->add_control_dependency(read);
+    relu->add_control_dependency(assign);
+
+    return std::make_shared<Function>(NodeVector{relu}, ParameterVector{input}, "Accumulator");
+}
+
+// Every infer request keeps its own state while the requests run concurrently on several stream graphs
+TEST(StatefulStreamsTest, requestsKeepOwnStatesWithMultipleStreams) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeAccumulator({1, 16}));
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"}});
+
+    constexpr int numRequests = 8;
+    constexpr int numIterations = 10;
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < numRequests; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        ASSERT_EQ(1, requests.back().QueryState().size());
+
+        auto input = requests.back().GetBlob(network.getInputsInfo().begin()->first);
+        auto data = input->buffer().as<float*>();
+        std::fill(data, data + input->size(), static_cast<float>(i + 1));
+    }
+
+    for (int iteration = 0; iteration < numIterations; iteration++) {
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            request.Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+
+    for (int i = 0; i < numRequests; i++) {
+        const float expected = static_cast<float>((i + 1) * numIterations);
+
+        auto output = requests[i].GetBlob(network.getOutputsInfo().begin()->first);
+        auto outputData = output->cbuffer().as<const float*>();
+        auto state = requests[i].QueryState().front().GetState();
+        auto stateData = state->cbuffer().as<const float*>();
+        for (size_t j = 0; j < output->size(); j++) {
+            ASSERT_EQ(expected, outputData[j]);
+            ASSERT_EQ(expected, stateData[j]);
+        }
+    }
+
+    requests.front().QueryState().front().Reset();
+    requests.front().Infer();
+    auto output = requests.front().GetBlob(network.getOutputsInfo().begin()->first);
+    ASSERT_EQ(1.0f, output->cbuffer().as<const float*>()[0]);
+}
+
+// The stream graph must not keep the state of a destroyed request
+TEST(StatefulStreamsTest, requestKeepsStateAfterOtherRequestOfStreamIsDestroyed) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeAccumulator({1, 16}));
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+
+    auto fillInput = [&] (InferRequest& request, float value) {
+        auto input = request.GetBlob(inputName);
+        auto data = input->buffer().as<float*>();
+        std::fill(data, data + input->size(), value);
+    };
+
+    auto request = execNet.CreateInferRequest();
+    fillInput(request, 1.0f);
+    request.Infer();
+    {
+        auto destroyed = execNet.CreateInferRequest();
+        fillInput(destroyed, 100.0f);
+        destroyed.Infer();
+        destroyed.Infer();
+    }
+    request.Infer();
+
+    auto state = request.QueryState().front().GetState();
+    auto stateData = state->cbuffer().as<const float*>();
+    auto output = request.GetBlob(outputName);
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t j = 0; j < output->size(); j++) {
+        ASSERT_EQ(2.0f, outputData[j]);
+        ASSERT_EQ(2.0f, stateData[j]);
+    }
+
+    // a new request of the same stream starts from the zero state
+    auto next = execNet.CreateInferRequest();
+    fillInput(next, 3.0f);
+    next.Infer();
+    auto nextOutput = next.GetBlob(outputName);
+    ASSERT_EQ(3.0f, nextOutput->cbuffer().as<const float*>()[0]);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
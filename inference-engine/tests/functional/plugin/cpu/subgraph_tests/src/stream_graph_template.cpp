@@ -0,0 +1,165 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Input shape
+        std::string,            // Number of streams
+        std::string             // Device name
+> StreamGraphTemplateTuple;
+
+// Graphs of all the streams except the first one on a NUMA node are created from the graph of the first stream
+// and share its constant data and primitives. The network has constant inputs which are executed only by the
+// template graph.
+class StreamGraphTemplateTest : public testing::WithParamInterface<StreamGraphTemplateTuple>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StreamGraphTemplateTuple> &obj) {
+        std::vector<size_t> inputShape;
+        std::string streams;
+        std::string targetName;
+        std::tie(inputShape, streams, targetName) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Streams=" << streams << "_";
+        results << "targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        std::string streams;
+        std::tie(inputShape, streams, targetDevice) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+
+        std::vector<size_t> constShape(inputShape.size(), 1);
+        constShape[1] = inputShape[1];
+        auto shift = ngraph::builder::makeConstant<float>(ngPrc, constShape, {}, true);
+        auto add = ngraph::builder::makeEltwise(params[0], shift, ngraph::helpers::EltwiseTypes::ADD);
+        auto conv = ngraph::builder::makeConvolution(add, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1, 8, 1, 1}, {}, true);
+        auto multiply = ngraph::builder::makeEltwise(conv, scale, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "StreamGraphTemplate");
+    }
+};
+
+TEST_P(StreamGraphTemplateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+// Graphs created from the template execute the shared primitives concurrently, their results match
+// the results of the single stream graph which is not created from a template (threads per stream
+// can differ, so the results are compared with a tolerance)
+TEST_P(StreamGraphTemplateTest, ConcurrentRequestsMatchSingleStream) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const auto inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+
+    auto singleStreamNet = ie->LoadNetwork(network, targetDevice, {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    auto streamsNet = ie->LoadNetwork(network, targetDevice, configuration);
+    const auto numStreams = streamsNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+
+    std::vector<Blob::Ptr> inputs;
+    std::vector<std::vector<float>> expected;
+    auto singleRequest = singleStreamNet.CreateInferRequest();
+    for (unsigned int i = 0; i < 2 * numStreams; i++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 10, -5, 10, i + 1));
+        singleRequest.SetBlob(inputName, inputs.back());
+        singleRequest.Infer();
+        auto output = singleRequest.GetBlob(outputName);
+        auto data = output->cbuffer().as<const float*>();
+        expected.emplace_back(data, data + output->size());
+    }
+
+    std::vector<InferRequest> requests;
+    for (auto&& input : inputs) {
+        requests.push_back(streamsNet.CreateInferRequest());
+        requests.back().SetBlob(inputName, input);
+    }
+    for (int round = 0; round < 3; round++) {
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto output = requests[i].GetBlob(outputName);
+            auto data = output->cbuffer().as<const float*>();
+            ASSERT_EQ(expected[i].size(), output->size());
+            for (size_t j = 0; j < expected[i].size(); j++)
+                ASSERT_NEAR(expected[i][j], data[j], 1e-5f * std::max(1.0f, std::abs(expected[i][j])))
+                    << "request " << i << ", round " << round << ", element " << j;
+        }
+    }
+}
+
+// Load time of a network with several stream graphs, graphs of all the streams except the first one on a NUMA node
+// take supported primitive descriptors, constants, primitives and the memory layout of the template graph
+TEST(StreamGraphTemplateLoadTest, DISABLED_loadTimeOverStreams) {
+    auto ie = PluginCache::get().ie();
+    const auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 32, 56, 56}});
+    ngraph::Output<ngraph::Node> output = params[0];
+    for (size_t i = 0; i < 16; i++) {
+        auto conv = ngraph::builder::makeConvolution(output, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 32);
+        output = std::make_shared<ngraph::opset1::Relu>(conv);
+        if (i % 4 == 3)
+            output = ngraph::builder::makePooling(output, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                  ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+    CNNNetwork network(std::make_shared<ngraph::Function>(results, params, "StreamGraphTemplateLoad"));
+
+    for (auto streams : {"1", "4", "16"}) {
+        auto start = std::chrono::steady_clock::now();
+        ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams}});
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        RecordProperty(std::string("LoadUs_") + streams + "Streams", static_cast<int>(elapsed.count()));
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_StreamGraphTemplate, StreamGraphTemplateTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 4, 16, 16}),
+                                ::testing::Values("1", "4", "16", PluginConfigParams::CPU_THROUGHPUT_AUTO),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        StreamGraphTemplateTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
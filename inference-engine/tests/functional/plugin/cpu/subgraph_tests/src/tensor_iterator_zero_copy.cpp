@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        bool,                   // Loop (true) or TensorIterator (false)
+        int64_t,                // Number of iterations
+        int64_t,                // Stride of sliced input and output
+        bool,                   // Back edge output is shared by two back edges, so the back edges are copied
+        std::string             // Device name
+> TensorIteratorZeroCopyTuple;
+
+// X -> [H' = H + X[i], Y[i] = H' + H] -> H', Y
+// The back edge swaps the body buffers and the sliced ports use chunks of the full tensors in place unless
+// the back edge output is shared, results of both paths are compared with the reference for both iteration
+// count parities and both slicing directions.
+class TensorIteratorZeroCopyTest : public testing::WithParamInterface<TensorIteratorZeroCopyTuple>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorZeroCopyTuple> &obj) {
+        bool isLoop;
+        int64_t iterations, stride;
+        bool sharedBackEdge;
+        std::string targetName;
+        std::tie(isLoop, iterations, stride, sharedBackEdge, targetName) = obj.param;
+
+        std::ostringstream results;
+        results << (isLoop ? "Loop" : "TensorIterator") << "_";
+        results << "Iterations=" << iterations << "_";
+        results << "Stride=" << stride << "_";
+        results << "SharedBackEdge=" << sharedBackEdge << "_";
+        results << "targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool isLoop;
+        int64_t iterations, stride;
+        bool sharedBackEdge;
+        std::tie(isLoop, iterations, stride, sharedBackEdge, targetDevice) = this->GetParam();
+
+        const auto ngPrc = ngraph::element::f32;
+        const ngraph::Shape partShape{1, 1, 8};
+        auto x = std::make_shared<ngraph::opset5::Parameter>(ngPrc, ngraph::Shape{1, static_cast<size_t>(iterations), 8});
+        auto h = std::make_shared<ngraph::opset5::Parameter>(ngPrc, partShape);
+
+        auto bodyX = std::make_shared<ngraph::opset5::Parameter>(ngPrc, partShape);
+        auto bodyH = std::make_shared<ngraph::opset5::Parameter>(ngPrc, partShape);
+        // has the same value as bodyH, but takes it through the second back edge from the same body output
+        auto bodyHCopy = std::make_shared<ngraph::opset5::Parameter>(ngPrc, partShape);
+        auto nextH = std::make_shared<ngraph::opset5::Add>(bodyH, bodyX);
+        auto y = std::make_shared<ngraph::opset5::Add>(nextH, sharedBackEdge ? bodyHCopy : bodyH);
+
+        ngraph::ParameterVector bodyParams{bodyX, bodyH};
+        if (sharedBackEdge)
+            bodyParams.push_back(bodyHCopy);
+        ngraph::OutputVector bodyResults{nextH, y};
+
+        std::shared_ptr<ngraph::op::util::SubGraphOp> subGraph;
+        if (isLoop) {
+            auto tripCount = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, iterations);
+            auto execCondition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+            bodyResults.push_back(std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true));
+            auto loop = std::make_shared<ngraph::opset5::Loop>(tripCount, execCondition);
+            loop->set_function(std::make_shared<ngraph::Function>(bodyResults, bodyParams));
+            loop->set_special_body_ports({-1, static_cast<int64_t>(bodyResults.size()) - 1});
+            subGraph = loop;
+        } else {
+            auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+            tensorIterator->set_function(std::make_shared<ngraph::Function>(bodyResults, bodyParams));
+            subGraph = tensorIterator;
+        }
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        subGraph->set_sliced_input(bodyX, x, start, stride, 1, end, 1);
+        subGraph->set_merged_input(bodyH, h, nextH);
+        if (sharedBackEdge)
+            subGraph->set_merged_input(bodyHCopy, h, nextH);
+        auto lastH = subGraph->get_iter_value(nextH, -1);
+        auto allY = subGraph->get_concatenated_slices(y, start, stride, 1, end, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(lastH),
+                                     std::make_shared<ngraph::opset5::Result>(allY)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{x, h}, "TensorIteratorZeroCopy");
+    }
+};
+
+TEST_P(TensorIteratorZeroCopyTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the swapped buffers stay in the graph after the inference, so the next inference starts from them
+    Infer();
+    Validate();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorZeroCopy, TensorIteratorZeroCopyTest,
+                        ::testing::Combine(
+                                ::testing::Values(false, true),
+                                ::testing::Values(1, 2, 3, 4),
+                                ::testing::Values(1, -1),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        TensorIteratorZeroCopyTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+// Weights of the networks loaded with several streams are shared through the plugin weights cache,
+// so the second load of the same network takes them from the cache
+TEST(WeightsCacheStatisticsTest, secondLoadOfNetworkHitsCache) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    std::map<std::string, std::string> config = {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}};
+
+    auto sum = [](const std::map<std::string, uint64_t>& statistics, const std::string& suffix) {
+        uint64_t value = 0;
+        for (auto&& item : statistics) {
+            const auto& key = item.first;
+            if (key.size() > suffix.size() && key.compare(key.size() - suffix.size(), suffix.size(), suffix) == 0)
+                value += item.second;
+        }
+        return value;
+    };
+
+    auto first = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    std::vector<std::string> metrics = first.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS)), metrics.end());
+    std::map<std::string, uint64_t> before = first.GetMetric(METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS));
+    ASSERT_FALSE(before.empty());
+
+    auto second = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    std::map<std::string, uint64_t> after = second.GetMetric(METRIC_KEY(CPU_WEIGHTS_CACHE_STATISTICS));
+
+    EXPECT_GT(sum(after, "_HITS"), sum(before, "_HITS"));
+    EXPECT_GT(sum(after, "_BYTES_SAVED"), sum(before, "_BYTES_SAVED"));
+    EXPECT_EQ(sum(after, "_MISSES"), sum(before, "_MISSES"));
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
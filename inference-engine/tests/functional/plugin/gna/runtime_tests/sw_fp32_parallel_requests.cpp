@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Param -> FC -> Sigmoid -> FC, large enough for the float kernels to split the work across threads
+std::shared_ptr<ngraph::Function> makeFunction() {
+    const auto ngPrc = ngraph::element::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 256}});
+    auto fc1 = ngraph::builder::makeFullyConnected(params[0], ngPrc, 512);
+    auto sigmoid = ngraph::builder::makeActivation(fc1, ngPrc, ngraph::helpers::ActivationTypes::Sigmoid);
+    auto fc2 = ngraph::builder::makeFullyConnected(sigmoid, ngPrc, 128);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{fc2}, params, "SwFp32ParallelRequests");
+}
+
+}  // namespace
+
+// Every parallel request of GNA_SW_FP32 mode runs on own copy of the float runtime relocated to its memory,
+// so the outputs of concurrent requests match the outputs of the same inputs inferred with a single request
+TEST(GnaSwFp32ParallelRequestsTest, concurrentRequestsMatchSingleRequest) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeFunction());
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const auto inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+
+    constexpr int numThreads = 4;
+    constexpr int numRequests = 2 * numThreads;
+    std::vector<Blob::Ptr> inputs;
+    for (int i = 0; i < numRequests; i++)
+        inputs.push_back(FuncTestUtils::createAndFillBlobFloat(inputDesc, 10, -5, 100, i + 1));
+
+    auto singleNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_GNA,
+                                     {{GNA_CONFIG_KEY(DEVICE_MODE), GNA_CONFIG_VALUE(SW_FP32)}});
+    auto singleRequest = singleNet.CreateInferRequest();
+    std::vector<std::vector<float>> expected;
+    for (auto&& input : inputs) {
+        singleRequest.SetBlob(inputName, input);
+        singleRequest.Infer();
+        auto output = singleRequest.GetBlob(outputName);
+        auto data = output->cbuffer().as<const float*>();
+        expected.emplace_back(data, data + output->size());
+    }
+
+    auto parallelNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_GNA,
+                                       {{GNA_CONFIG_KEY(DEVICE_MODE), GNA_CONFIG_VALUE(SW_FP32)},
+                                        {GNA_CONFIG_KEY(LIB_N_THREADS), std::to_string(numThreads)}});
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < numRequests; i++) {
+        requests.push_back(parallelNet.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[i]);
+    }
+
+    // several rounds, so the requests reuse the relocated runtimes
+    for (int round = 0; round < 3; round++) {
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+
+        for (int i = 0; i < numRequests; i++) {
+            auto output = requests[i].GetBlob(outputName);
+            auto data = output->cbuffer().as<const float*>();
+            ASSERT_EQ(expected[i].size(), output->size());
+            for (size_t j = 0; j < expected[i].size(); j++)
+                ASSERT_NEAR(expected[i][j], data[j], 1e-4f * std::max(1.0f, std::abs(expected[i][j])))
+                    << "request " << i << ", round " << round << ", element " << j;
+        }
+    }
+}
@@ -10,6 +10,7 @@
 #include <memory>
 #include <fstream>
 #include <ngraph/variant.hpp>
+#include <ngraph/graph_util.hpp>
 #include <hetero/hetero_plugin_config.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
 #include <multi-device/multi_device_config.hpp>
@@ -141,6 +142,7 @@ using IEClassNetworkTestP = IEClassBaseTestP;
 using IEClassGetMetricTest = IEClassBaseTestP;
 using IEClassQueryNetworkTest = IEClassBaseTestP;
 using IEClassImportExportTestP = IEClassBaseTestP;
+using IEClassNetworkCacheTestP = IEClassBaseTestP;
 using IEClassGetMetricTest_SUPPORTED_METRICS = IEClassBaseTestP;
 using IEClassGetMetricTest_SUPPORTED_CONFIG_KEYS = IEClassBaseTestP;
 using IEClassGetMetricTest_AVAILABLE_DEVICES = IEClassBaseTestP;
@@ -510,6 +512,139 @@ TEST_P(IEClassImportExportTestP, smoke_ImportNetworkNoThrowWithDeviceName) {
     }
 }
 
+TEST_P(IEClassNetworkCacheTestP, smoke_LoadNetworkUsesCacheDir) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const std::string cacheDir = "network_cache_" + deviceName;
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    {
+        Core ie;
+        std::vector<std::string> metrics = ie.GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) == metrics.end()) {
+            GTEST_SKIP();
+        }
+
+        ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+        ExecutableNetwork executableNetwork;
+        ASSERT_NO_THROW(executableNetwork = ie.LoadNetwork(simpleNetwork, deviceName));
+        ASSERT_EQ(0u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+        ASSERT_EQ(1u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+
+        ASSERT_NO_THROW(executableNetwork = ie.LoadNetwork(simpleNetwork, deviceName));
+        ASSERT_EQ(1u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+        ASSERT_EQ(1u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+        ASSERT_NO_THROW(executableNetwork.CreateInferRequest());
+
+        // other network is compiled and cached separately
+        ASSERT_NO_THROW(executableNetwork = ie.LoadNetwork(actualNetwork, deviceName));
+        ASSERT_EQ(2u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+    }
+    {
+        // cache directory is shared between Core objects
+        Core ie;
+        ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+        ASSERT_NO_THROW(ie.LoadNetwork(actualNetwork, deviceName));
+        ASSERT_EQ(1u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+        ASSERT_EQ(0u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+    }
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+}
+
+TEST_P(IEClassNetworkCacheTestP, smoke_LoadNetworkCacheKeyDistinguishesCloseMeanValues) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const std::string cacheDir = "network_cache_mean_" + deviceName;
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    {
+        Core ie;
+        std::vector<std::string> metrics = ie.GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) == metrics.end()) {
+            GTEST_SKIP();
+        }
+        ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+
+        // mean values equal in the first 6 significant digits must not share a cached network
+        for (float meanValue : {0.1234567f, 0.1234568f}) {
+            CNNNetwork network(simpleNetwork.getFunction());
+            auto input = network.getInputsInfo().begin()->second;
+            auto& preProcess = input->getPreProcess();
+            const size_t channels = input->getTensorDesc().getDims()[1];
+            preProcess.init(channels);
+            for (size_t c = 0; c < channels; c++) {
+                preProcess[c]->meanValue = meanValue;
+            }
+            preProcess.setVariant(MEAN_VALUE);
+            ASSERT_NO_THROW(ie.LoadNetwork(network, deviceName));
+        }
+        ASSERT_EQ(0u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+        ASSERT_EQ(2u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+    }
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+}
+
+TEST_P(IEClassNetworkCacheTestP, smoke_LoadNetworkCacheKeyTracksInputShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const std::string cacheDir = "network_cache_shapes_" + deviceName;
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    {
+        Core ie;
+        std::vector<std::string> metrics = ie.GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) == metrics.end()) {
+            GTEST_SKIP();
+        }
+        ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+
+        // the content of the function is hashed once, so the reshaped network must differ by input shapes
+        CNNNetwork network(ngraph::clone_function(*simpleNetwork.getFunction()));
+        auto shapes = network.getInputShapes();
+        auto reshaped = shapes;
+        reshaped.begin()->second[0] = 2;
+        ASSERT_NO_THROW(ie.LoadNetwork(network, deviceName));
+        ASSERT_NO_THROW(network.reshape(reshaped));
+        ASSERT_NO_THROW(ie.LoadNetwork(network, deviceName));
+        ASSERT_EQ(0u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+        ASSERT_EQ(2u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>());
+
+        ASSERT_NO_THROW(network.reshape(shapes));
+        ASSERT_NO_THROW(ie.LoadNetwork(network, deviceName));
+        ASSERT_EQ(1u, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+    }
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+}
+
+TEST_P(IEClassNetworkCacheTestP, smoke_LoadNetworkCacheKeyOfReadModelTracksFiles) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const std::string cacheDir = "network_cache_files_" + deviceName;
+    const std::string modelPath = "network_cache_model_" + deviceName + ".xml";
+    const std::string weightsPath = "network_cache_model_" + deviceName + ".bin";
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    {
+        Core ie;
+        std::vector<std::string> metrics = ie.GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) == metrics.end()) {
+            GTEST_SKIP();
+        }
+    }
+    auto loadModel = [&] (unsigned int expectedHits) {
+        Core ie;
+        ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+        ASSERT_NO_THROW(ie.LoadNetwork(ie.ReadNetwork(modelPath), deviceName));
+        ASSERT_EQ(expectedHits, ie.GetMetric(deviceName, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>());
+    };
+    ASSERT_NO_THROW(simpleNetwork.serialize(modelPath, weightsPath));
+    loadModel(0u);
+    // the same files are found in the cache by another Core
+    loadModel(1u);
+    // the files are rewritten when no network refers to the mapped weights any more
+    ASSERT_NO_THROW(actualNetwork.serialize(modelPath, weightsPath));
+    loadModel(0u);
+    CommonTestUtils::removeFile(modelPath);
+    CommonTestUtils::removeFile(weightsPath);
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+}
+
 TEST_P(IEClassImportExportTestP, smoke_ExportUsingFileNameImportFromStreamNoThrowWithDeviceName) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     Core ie;
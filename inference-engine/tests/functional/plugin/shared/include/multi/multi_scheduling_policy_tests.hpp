@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, canInferWithEarliestCompletionPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names,
+        {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(POLICY_EARLIEST_COMPLETION)}});
+    ASSERT_EQ(std::string{MULTI_CONFIG_VALUE(POLICY_EARLIEST_COMPLETION)},
+              exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+
+    // more requests than the devices have, so some of them wait in the queues
+    const auto optimalNum = exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < 2 * optimalNum; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+    }
+    for (int round = 0; round < 3; round++) {
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.StartAsync());
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+        }
+    }
+}
+
+TEST_P(MultiDevice_Test, cannotLoadWithUnsupportedSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), "UNKNOWN"}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
@@ -8,6 +8,7 @@
 #include <ngraph/variant.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <hetero/hetero_plugin_config.hpp>
 #include <random>
 namespace HeteroTests {
 
@@ -150,4 +151,76 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedRequestsGiveSameResults) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = CONFIG_VALUE(YES);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+
+    // stages of the requests started together overlap on the shared request pools
+    std::vector<InferenceEngine::InferRequest> requests(4);
+    for (auto&& request : requests) {
+        request = executableNetwork.CreateInferRequest();
+        std::size_t i = 0;
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            request.SetBlob(input.first, inputs[i++]);
+        }
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(inferRequest.GetBlob(output.first), request.GetBlob(output.first));
+        }
+    }
+
+    auto statistics = executableNetwork.GetMetric(METRIC_KEY(HETERO_PIPELINE_STATISTICS)).as<std::map<std::string, float>>();
+    ASSERT_EQ(static_cast<float>(1 + requests.size()), statistics.at("STAGE_0_INFERENCES"));
+    ASSERT_LE(statistics.at("STAGE_0_UTILIZATION"), 1.f);
+}
+
+TEST_P(HeteroSyntheticTest, pipelinedPerformanceCountsDoNotChangeWithOtherRequests) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = CONFIG_VALUE(YES);
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+
+    auto perfCounts = inferRequest.GetPerformanceCounts();
+    ASSERT_FALSE(perfCounts.empty());
+    for (auto&& perfCount : perfCounts) {
+        ASSERT_EQ(0u, perfCount.first.find("subgraph"));
+    }
+
+    // other requests reuse the pooled request that ran the stages of the first one
+    std::vector<InferenceEngine::InferRequest> requests(4);
+    for (auto&& request : requests) {
+        request = executableNetwork.CreateInferRequest();
+        std::size_t i = 0;
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            request.SetBlob(input.first, inputs[i++]);
+        }
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_EQ(perfCounts.size(), request.GetPerformanceCounts().size());
+    }
+
+    auto perfCountsAfter = inferRequest.GetPerformanceCounts();
+    ASSERT_EQ(perfCounts.size(), perfCountsAfter.size());
+    for (auto&& perfCount : perfCounts) {
+        auto& perfCountAfter = perfCountsAfter.at(perfCount.first);
+        ASSERT_EQ(perfCount.second.realTime_uSec, perfCountAfter.realTime_uSec);
+        ASSERT_EQ(perfCount.second.cpu_uSec, perfCountAfter.cpu_uSec);
+        ASSERT_EQ(perfCount.second.status, perfCountAfter.status);
+    }
+}
+
 }  //  namespace HeteroTests
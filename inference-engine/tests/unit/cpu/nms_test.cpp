@@ -0,0 +1,198 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/nms.h"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+
+// xmin, ymin, xmax, ymax boxes with scores, boxes are grouped around few centers to make suppression happen
+struct NmsData {
+    std::vector<float> boxes;
+    std::vector<float> scores;
+};
+
+NmsData generateData(int num_boxes, int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> center(0.f, 1.f);
+    std::uniform_real_distribution<float> jitter(-0.02f, 0.02f);
+    std::uniform_real_distribution<float> size(0.f, 0.2f);
+    // coarse scores give many ties to check the order of equal candidates
+    std::uniform_int_distribution<int> score(0, 100);
+
+    std::vector<float> centers(2 * (num_boxes / 8 + 1));
+    for (auto &&value : centers)
+        value = center(gen);
+
+    NmsData data;
+    data.boxes.resize(4 * num_boxes);
+    data.scores.resize(num_boxes);
+    for (int i = 0; i < num_boxes; i++) {
+        const int group = static_cast<int>(gen() % (centers.size() / 2));
+        const float cx = centers[2 * group] + jitter(gen), cy = centers[2 * group + 1] + jitter(gen);
+        const float w = size(gen), h = size(gen);
+        data.boxes[4 * i + 0] = cx - w / 2;
+        data.boxes[4 * i + 1] = cy - h / 2;
+        data.boxes[4 * i + 2] = cx + w / 2;
+        data.boxes[4 * i + 3] = cy + h / 2;
+        data.scores[i] = score(gen) / 100.f;
+    }
+    return data;
+}
+
+// the loops which NonMaxSuppression and DetectionOutput used before the vectorized selection
+float referenceIoU(const float *boxI, const float *boxJ) {
+    const float areaI = (boxI[2] - boxI[0]) * (boxI[3] - boxI[1]);
+    const float areaJ = (boxJ[2] - boxJ[0]) * (boxJ[3] - boxJ[1]);
+    if (areaI <= 0.f || areaJ <= 0.f)
+        return 0.f;
+    const float intersection = (std::max)((std::min)(boxI[2], boxJ[2]) - (std::max)(boxI[0], boxJ[0]), 0.f) *
+                               (std::max)((std::min)(boxI[3], boxJ[3]) - (std::max)(boxI[1], boxJ[1]), 0.f);
+    return intersection / (areaI + areaJ - intersection);
+}
+
+std::vector<int> referenceNms(const NmsData &data, float score_threshold, int top_k, const nms_conf &conf) {
+    std::vector<std::pair<float, int>> sorted;
+    for (int i = 0; i < static_cast<int>(data.scores.size()); i++) {
+        if (data.scores[i] > score_threshold)
+            sorted.emplace_back(data.scores[i], i);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const std::pair<float, int> &l, const std::pair<float, int> &r) {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    });
+    if (top_k >= 0 && top_k < static_cast<int>(sorted.size()))
+        sorted.resize(top_k);
+
+    std::vector<int> selected;
+    for (size_t i = 0; i < sorted.size() && static_cast<int>(selected.size()) < conf.max_output_boxes; i++) {
+        bool keep = true;
+        for (int kept : selected) {
+            const float iou = referenceIoU(&data.boxes[4 * sorted[i].second], &data.boxes[4 * kept]);
+            if (conf.suppress_equal ? iou >= conf.iou_threshold : iou > conf.iou_threshold) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep)
+            selected.push_back(sorted[i].second);
+    }
+    return selected;
+}
+
+std::vector<int> engineNms(NmsWorkspace &workspace, const NmsData &data, float score_threshold, int top_k, const nms_conf &conf) {
+    workspace.candidates.clear();
+    for (int i = 0; i < static_cast<int>(data.scores.size()); i++) {
+        if (data.scores[i] > score_threshold)
+            workspace.candidates.push_back({data.scores[i], i});
+    }
+    const int count = nms_hard(workspace, top_k, conf, [&](int idx, float &xmin, float &ymin, float &xmax, float &ymax) {
+        xmin = data.boxes[4 * idx + 0];
+        ymin = data.boxes[4 * idx + 1];
+        xmax = data.boxes[4 * idx + 2];
+        ymax = data.boxes[4 * idx + 3];
+    });
+    std::vector<int> selected;
+    for (int i = 0; i < count; i++)
+        selected.push_back(workspace.candidates[workspace.selected[i]].index);
+    return selected;
+}
+
+void measure(const std::string &name, const std::function<void()> &kernel) {
+    const int iterations = 10;
+    kernel();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        kernel();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << elapsed.count() / iterations << " us" << std::endl;
+}
+
+// boxes, top_k, max output boxes, iou threshold, suppress equal
+using NmsParams = std::tuple<int, int, int, float, bool>;
+
+class NmsEngineTest : public ::testing::TestWithParam<NmsParams> {
+protected:
+    void SetUp() override {
+        int max_output;
+        std::tie(num_boxes, top_k, max_output, conf.iou_threshold, conf.suppress_equal) = GetParam();
+        conf.max_output_boxes = max_output;
+        workspace.reserve(num_boxes);
+    }
+
+    int num_boxes = 0;
+    int top_k = -1;
+    nms_conf conf = {};
+    NmsWorkspace workspace;
+};
+
+TEST_P(NmsEngineTest, selectionMatchesReference) {
+    for (int seed = 0; seed < 4; seed++) {
+        const NmsData data = generateData(num_boxes, seed);
+        for (float score_threshold : {-1.f, 0.3f}) {
+            ASSERT_EQ(referenceNms(data, score_threshold, top_k, conf), engineNms(workspace, data, score_threshold, top_k, conf))
+                << "seed " << seed << " score threshold " << score_threshold;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CPU, NmsEngineTest,
+                        ::testing::Values(NmsParams{1, -1, 10, 0.5f, true},
+                                          NmsParams{17, -1, 17, 0.f, true},
+                                          NmsParams{100, -1, 100, 0.5f, true},
+                                          NmsParams{100, 50, 100, 0.45f, false},
+                                          NmsParams{1000, -1, 5, 0.5f, true},
+                                          NmsParams{1000, 200, 1000, 0.3f, false},
+                                          NmsParams{3000, -1, 100, 0.7f, true}));
+
+// boxes, classes, top_k, max output boxes per class, iou threshold, suppress equal
+using NmsPerfParams = std::tuple<int, int, int, int, float, bool>;
+
+class NmsEnginePerfTest : public ::testing::TestWithParam<NmsPerfParams> {};
+
+TEST_P(NmsEnginePerfTest, DISABLED_perf_nms) {
+    int num_boxes, num_classes, top_k, max_output;
+    nms_conf conf;
+    std::tie(num_boxes, num_classes, top_k, max_output, conf.iou_threshold, conf.suppress_equal) = GetParam();
+    conf.max_output_boxes = max_output;
+
+    std::vector<NmsData> data;
+    for (int c = 0; c < num_classes; c++)
+        data.push_back(generateData(num_boxes, c));
+    const float score_threshold = 0.01f;
+
+    NmsWorkspaces workspaces;
+    workspaces.prepare(num_boxes);
+    const std::string shape = std::to_string(num_boxes) + " boxes x " + std::to_string(num_classes) + " classes";
+    measure("reference NMS " + shape, [&] {
+        parallel_for(num_classes, [&](int c) {
+            referenceNms(data[c], score_threshold, top_k, conf);
+        });
+    });
+    measure("vectorized NMS " + shape, [&] {
+        parallel_for(num_classes, [&](int c) {
+            engineNms(workspaces.local(), data[c], score_threshold, top_k, conf);
+        });
+    });
+}
+
+// SSD300 DetectionOutput, YOLOv3 and tiny YOLOv3 NonMaxSuppression sizes
+INSTANTIATE_TEST_CASE_P(CPU, NmsEnginePerfTest,
+                        ::testing::Values(NmsPerfParams{8732, 20, 400, 8732, 0.45f, false},
+                                          NmsPerfParams{10647, 80, -1, 100, 0.5f, true},
+                                          NmsPerfParams{2535, 80, -1, 2535, 0.5f, true}));
+
+}  // namespace
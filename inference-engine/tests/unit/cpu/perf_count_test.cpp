@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+void execute(PerfCount &counter, int times) {
+    for (int i = 0; i < times; i++) {
+        PerfHelper helper(counter);
+    }
+}
+
+}  // namespace
+
+TEST(PerfCountTest, historyIsDisabledByDefault) {
+    PerfCount counter;
+    execute(counter, 5);
+
+    ASSERT_TRUE(counter.samples().empty());
+    ASSERT_EQ(0u, counter.percentile(50));
+}
+
+TEST(PerfCountTest, historyKeepsLastExecutionsInOrder) {
+    PerfCount counter;
+    counter.enableHistory(4);
+
+    execute(counter, 3);
+    auto samples = counter.samples();
+    ASSERT_EQ(3u, samples.size());
+
+    execute(counter, 6);
+    samples = counter.samples();
+    ASSERT_EQ(4u, samples.size());
+    for (size_t i = 0; i < samples.size(); i++) {
+        ASSERT_LE(samples[i].start, samples[i].finish);
+        if (i > 0)
+            ASSERT_LE(samples[i - 1].finish, samples[i].start);
+    }
+}
+
+TEST(PerfCountTest, percentilesAreBoundedByKeptExecutions) {
+    PerfCount counter;
+    counter.enableHistory(100);
+    for (int i = 0; i < 100; i++) {
+        PerfHelper helper(counter);
+        if (i % 10 == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    uint64_t min = UINT64_MAX, max = 0;
+    for (auto &sample : counter.samples()) {
+        min = (std::min)(min, sample.finish - sample.start);
+        max = (std::max)(max, sample.finish - sample.start);
+    }
+    ASSERT_LE(min, counter.percentile(50));
+    ASSERT_LE(counter.percentile(50), counter.percentile(99));
+    ASSERT_LE(counter.percentile(99), max);
+    ASSERT_EQ(max, counter.percentile(100));
+    ASSERT_EQ(min, counter.percentile(0));
+    // 10 executions with sleep are the slowest ones
+    ASSERT_GE(counter.percentile(99), 200000u);
+}
+
+TEST(PerfCountTest, samplesKeepExecutingThread) {
+    PerfCount counter;
+    counter.enableHistory(2);
+
+    execute(counter, 1);
+    std::thread([&] { execute(counter, 1); }).join();
+
+    auto samples = counter.samples();
+    ASSERT_EQ(2u, samples.size());
+    ASSERT_NE(samples[0].thread, samples[1].thread);
+}
@@ -0,0 +1,271 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+
+namespace {
+
+// naive loops of the reference float runtime, kept to check and benchmark optimized kernels against
+void referenceAffine(int M, int N, int K, const float *A, const float *B, const float *bias, float *C) {
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float sum = bias[i];
+            for (int k = 0; k < K; k++) {
+                sum += A[i * K + k] * B[k * N + j];
+            }
+            C[i * N + j] = sum;
+        }
+    }
+}
+
+void referenceConv1D(const intel_dnn_component_t &component, float *ptr_outputs) {
+    auto &conv = component.op.conv1D;
+    auto ptr_filters = reinterpret_cast<const float *>(conv.ptr_filters);
+    auto ptr_biases = reinterpret_cast<const float *>(conv.ptr_biases);
+    auto ptr_inputs = reinterpret_cast<const float *>(component.ptr_inputs);
+    uint32_t num_filter_outputs = conv.num_feature_map_rows - conv.num_filter_rows + 1;
+    uint32_t num_inputs_band_stride = conv.num_feature_maps * conv.num_feature_map_columns;
+    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+        for (uint32_t i = 0; i < conv.num_filters; i++) {
+            float sum = ptr_biases[i];
+            for (uint32_t k = 0; k < conv.num_filter_coefficients; k++) {
+                sum += ptr_inputs[j * num_inputs_band_stride + k] * ptr_filters[i * conv.num_filter_coefficients + k];
+            }
+            ptr_outputs[j * conv.num_filters + i] = sum;
+        }
+    }
+}
+
+void referencePool(const intel_dnn_component_t &component, float *ptr_outputs) {
+    auto &pool = component.op.maxpool;
+    auto ptr_inputs = reinterpret_cast<const float *>(component.ptr_inputs);
+    uint32_t num_columns = pool.num_inputs_stride;
+    uint32_t num_rows_in = component.num_columns_in / num_columns;
+    for (uint32_t i = 0; i < num_columns; i++) {
+        uint32_t m = 0;
+        for (uint32_t j = 0; j < num_rows_in; j += pool.num_inputs_step, m++) {
+            uint32_t num_end = std::min(num_rows_in, j + pool.num_inputs);
+            float result = pool.do_sum_not_max ? 0.0f : -1e20f;
+            for (uint32_t k = j; k < num_end; k++) {
+                float value = ptr_inputs[k * num_columns + i];
+                result = pool.do_sum_not_max ? result + value : std::max(result, value);
+            }
+            ptr_outputs[m * num_columns + i] = result;
+        }
+    }
+}
+
+std::vector<float> randomData(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> data(size);
+    for (auto &&value : data) {
+        value = dist(gen);
+    }
+    return data;
+}
+
+void expectNear(const std::vector<float> &expected, const std::vector<float> &actual, float threshold) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], threshold * std::max(1.0f, std::abs(expected[i]))) << "at index " << i;
+    }
+}
+
+void measure(const std::string &name, const std::function<void()> &kernel) {
+    const int iterations = 20;
+    kernel();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        kernel();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << elapsed.count() / iterations << " us" << std::endl;
+}
+
+// rows, columns (batch), inputs
+using AffineParams = std::tuple<int, int, int>;
+
+class GNAFloatAffineTest : public ::testing::TestWithParam<AffineParams> {
+ protected:
+    void SetUp() override {
+        std::tie(M, N, K) = GetParam();
+        A = randomData(static_cast<size_t>(M) * K);
+        B = randomData(static_cast<size_t>(K) * N);
+        bias = randomData(M);
+    }
+
+    void affine(float *C) {
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                C[i * N + j] = bias[i];
+            }
+        }
+        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C, N);
+    }
+
+    int M = 0, N = 0, K = 0;
+    std::vector<float> A, B, bias;
+};
+
+TEST_P(GNAFloatAffineTest, sgemmMatchesReference) {
+    std::vector<float> expected(static_cast<size_t>(M) * N), actual(expected.size());
+    referenceAffine(M, N, K, A.data(), B.data(), bias.data(), expected.data());
+    affine(actual.data());
+    expectNear(expected, actual, 1e-4f);
+}
+
+TEST_P(GNAFloatAffineTest, sgemmSubsetMatchesReference) {
+    std::vector<uint32_t> list;
+    for (int i = M - 1; i >= 0; i -= 3) {
+        list.push_back(i);
+    }
+    const int L = static_cast<int>(list.size());
+    std::vector<float> full(static_cast<size_t>(M) * N);
+    referenceAffine(M, N, K, A.data(), B.data(), bias.data(), full.data());
+
+    std::vector<float> expected(static_cast<size_t>(L) * N), actual(expected.size());
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            expected[l * N + j] = full[list[l] * N + j];
+            actual[l * N + j] = bias[list[l]];
+        }
+    }
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                       actual.data(), N, list.data(), L);
+    expectNear(expected, actual, 1e-4f);
+}
+
+TEST_P(GNAFloatAffineTest, DISABLED_perf_sgemm) {
+    std::vector<float> C(static_cast<size_t>(M) * N);
+    const std::string shape = std::to_string(M) + "x" + std::to_string(K) + "x" + std::to_string(N);
+    measure("reference affine " + shape, [&] { referenceAffine(M, N, K, A.data(), B.data(), bias.data(), C.data()); });
+    measure("cblas_sgemm1 affine " + shape, [&] { affine(C.data()); });
+}
+
+// small layers stay sequential, speech model layers with 1 and 8 frames go parallel
+INSTANTIATE_TEST_CASE_P(GNAFloatRuntime, GNAFloatAffineTest,
+                        ::testing::Values(AffineParams{7, 1, 13},
+                                          AffineParams{33, 3, 65},
+                                          AffineParams{512, 1, 440},
+                                          AffineParams{2048, 8, 512},
+                                          AffineParams{8192, 4, 1024}));
+
+// filters, filter rows, feature map rows, feature map columns
+using ConvParams = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+
+class GNAFloatConv1DTest : public ::testing::TestWithParam<ConvParams> {
+ protected:
+    void SetUp() override {
+        uint32_t num_filters, num_filter_rows, num_feature_map_rows, num_feature_map_columns;
+        std::tie(num_filters, num_filter_rows, num_feature_map_rows, num_feature_map_columns) = GetParam();
+        auto &conv = component.op.conv1D;
+        conv.num_filters = num_filters;
+        conv.num_filter_rows = num_filter_rows;
+        conv.num_feature_maps = 1;
+        conv.num_feature_map_rows = num_feature_map_rows;
+        conv.num_feature_map_columns = num_feature_map_columns;
+        conv.num_filter_coefficients = num_filter_rows * num_feature_map_columns;
+        num_outputs = (num_feature_map_rows - num_filter_rows + 1) * num_filters;
+
+        filters = randomData(num_filters * conv.num_filter_coefficients);
+        biases = randomData(num_filters);
+        inputs = randomData(num_feature_map_rows * num_feature_map_columns);
+        conv.ptr_filters = filters.data();
+        conv.ptr_biases = biases.data();
+        component.ptr_inputs = inputs.data();
+        component.num_rows_in = 1;
+        component.num_rows_out = 1;
+        component.num_columns_in = static_cast<uint32_t>(inputs.size());
+        component.num_columns_out = num_outputs;
+        component.original_layer_name = "conv";
+    }
+
+    intel_dnn_component_t component = {};
+    uint32_t num_outputs = 0;
+    std::vector<float> filters, biases, inputs;
+};
+
+TEST_P(GNAFloatConv1DTest, filterMatchesReference) {
+    std::vector<float> expected(num_outputs), actual(num_outputs);
+    referenceConv1D(component, expected.data());
+    component.ptr_outputs = actual.data();
+    CNNFilter32(&component);
+    expectNear(expected, actual, 1e-4f);
+}
+
+TEST_P(GNAFloatConv1DTest, DISABLED_perf_filter) {
+    std::vector<float> outputs(num_outputs);
+    component.ptr_outputs = outputs.data();
+    const std::string shape = std::to_string(component.op.conv1D.num_filters) + " filters x " +
+                              std::to_string(component.op.conv1D.num_filter_coefficients) + " coefficients";
+    measure("reference conv1D " + shape, [&] { referenceConv1D(component, outputs.data()); });
+    measure("CNNFilter32 " + shape, [&] { CNNFilter32(&component); });
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatRuntime, GNAFloatConv1DTest,
+                        ::testing::Values(ConvParams{4, 3, 10, 5},
+                                          ConvParams{32, 8, 100, 3},
+                                          ConvParams{128, 9, 440, 8}));
+
+// pool size, pool step, stride (number of filters), rows
+using PoolParams = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, bool>;
+
+class GNAFloatPoolTest : public ::testing::TestWithParam<PoolParams> {
+ protected:
+    void SetUp() override {
+        uint32_t num_rows;
+        auto &pool = component.op.maxpool;
+        std::tie(pool.num_inputs, pool.num_inputs_step, pool.num_inputs_stride, num_rows, pool.do_sum_not_max) = GetParam();
+        inputs = randomData(pool.num_inputs_stride * num_rows);
+        component.ptr_inputs = inputs.data();
+        component.num_columns_in = static_cast<uint32_t>(inputs.size());
+        num_outputs = (num_rows + pool.num_inputs_step - 1) / pool.num_inputs_step * pool.num_inputs_stride;
+    }
+
+    intel_dnn_component_t component = {};
+    uint32_t num_outputs = 0;
+    std::vector<float> inputs;
+};
+
+TEST_P(GNAFloatPoolTest, poolMatchesReference) {
+    std::vector<float> expected(num_outputs), actual(num_outputs);
+    referencePool(component, expected.data());
+    component.ptr_outputs = actual.data();
+    CNNMaxPool(&component, kDnnFloat);
+    expectNear(expected, actual, 1e-5f);
+}
+
+TEST_P(GNAFloatPoolTest, DISABLED_perf_pool) {
+    std::vector<float> outputs(num_outputs);
+    component.ptr_outputs = outputs.data();
+    const std::string shape = std::to_string(component.num_columns_in) + " inputs";
+    measure("reference pool " + shape, [&] { referencePool(component, outputs.data()); });
+    measure("CNNMaxPool " + shape, [&] { CNNMaxPool(&component, kDnnFloat); });
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatRuntime, GNAFloatPoolTest,
+                        ::testing::Values(PoolParams{3, 3, 8, 10, false},
+                                          PoolParams{3, 2, 8, 11, true},
+                                          PoolParams{6, 3, 128, 432, false},
+                                          PoolParams{2, 2, 256, 1000, true}));
+
+}  // namespace
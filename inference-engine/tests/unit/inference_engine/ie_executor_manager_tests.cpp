@@ -36,3 +36,15 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, returnTheSameSharedStreamsExecutorWhileItIsUsed) {
+    ExecutorManagerImpl _manager;
+    IStreamsExecutor::Config config{"SharedStreamsExecutor", 1};
+    auto executor1 = _manager.getSharedCPUStreamsExecutor(config);
+    auto executor2 = _manager.getSharedCPUStreamsExecutor(config);
+    auto idleExecutor = _manager.getIdleCPUStreamsExecutor(config);
+
+    ASSERT_EQ(executor1, executor2);
+    ASSERT_NE(executor1, idleExecutor);
+    ASSERT_EQ(2, _manager.getIdleCPUStreamsExecutorsNumber());
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ie_memcpy.h"
+
+namespace {
+
+std::vector<uint8_t> makeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    return data;
+}
+
+}  // namespace
+
+class IEMemcpyTests : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(IEMemcpyTests, copiesAllBytes) {
+    const auto size = GetParam();
+    auto src = makeData(size);
+    std::vector<uint8_t> dst(size + 1, 0);
+
+    ASSERT_EQ(0, ie_memcpy(dst.data(), dst.size(), src.data(), size));
+    ASSERT_TRUE(std::equal(src.begin(), src.end(), dst.begin()));
+    ASSERT_EQ(0, dst.back());
+}
+
+// Buffers larger than 1MB are copied by several threads with not aligned tails
+INSTANTIATE_TEST_CASE_P(IEMemcpy, IEMemcpyTests,
+                        ::testing::Values(1, 63, 4096, (1 << 20) - 1, (1 << 20) + 13, (5 << 20) + 255));
+
+TEST(IEMemcpyErrorTests, failsIfDestinationIsTooSmall) {
+    auto src = makeData(16);
+    std::vector<uint8_t> dst(8, 1);
+
+    ASSERT_NE(0, ie_memcpy(dst.data(), dst.size(), src.data(), src.size()));
+    for (auto value : dst) {
+        ASSERT_EQ(0, value);
+    }
+}
+
+TEST(IEMemcpyErrorTests, failsIfBuffersOverlap) {
+    auto data = makeData(64);
+
+    ASSERT_NE(0, ie_memcpy(data.data() + 8, 32, data.data(), 32));
+}
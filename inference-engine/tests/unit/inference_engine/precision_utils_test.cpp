@@ -6,7 +6,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
 #include <limits>
+#include <tuple>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +53,93 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+namespace {
+
+std::vector<ie_fp16> allFP16Values(size_t size) {
+    std::vector<ie_fp16> values(size);
+    for (size_t i = 0; i < size; i++) {
+        values[i] = static_cast<ie_fp16>(i & 0xFFFF);
+    }
+    return values;
+}
+
+std::vector<float> sampledFP32Values(size_t size) {
+    std::vector<float> values(size);
+    uint32_t bits = 0;
+    for (size_t i = 0; i < size; i++, bits += 1021) {
+        std::memcpy(&values[i], &bits, sizeof(float));
+    }
+    return values;
+}
+
+}  // namespace
+
+using PrecisionUtilsArraysTests = ::testing::TestWithParam<std::tuple<size_t, float, float>>;
+
+// Vectorized and parallel array conversions must be bit-exact with the scalar ones
+TEST_P(PrecisionUtilsArraysTests, FP16ToFP32ArraysMatchScalar) {
+    size_t size;
+    float scale, bias;
+    std::tie(size, scale, bias) = GetParam();
+
+    const auto src = allFP16Values(size);
+    std::vector<float> dst(size);
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), size, scale, bias);
+
+    for (size_t i = 0; i < size; i++) {
+        const float ref = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+        ASSERT_EQ(0, std::memcmp(&ref, &dst[i], sizeof(float))) << "at index " << i;
+    }
+}
+
+TEST_P(PrecisionUtilsArraysTests, FP32ToFP16ArraysMatchScalar) {
+    size_t size;
+    float scale, bias;
+    std::tie(size, scale, bias) = GetParam();
+
+    auto src = sampledFP32Values(size);
+    const float special[] = {0.f, -0.f, 65504.f, 65520.f, 6.1e-5f, 3e-5f, 2.9e-8f,
+                             std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+                             std::numeric_limits<float>::denorm_min()};
+    std::copy_n(special, std::min(size, sizeof(special) / sizeof(special[0])), src.begin());
+    std::vector<ie_fp16> dst(size);
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), size, scale, bias);
+
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * scale + bias), dst[i]) << "at index " << i;
+    }
+}
+
+// Sizes are not multiple of vector length; arrays larger than 64K elements are converted by several threads
+INSTANTIATE_TEST_CASE_P(PrecisionUtils, PrecisionUtilsArraysTests,
+                        ::testing::Combine(::testing::Values(1, 15, 37, 65536, (1 << 20) + 3),
+                                           ::testing::Values(1.f, 0.5f),
+                                           ::testing::Values(0.f, -0.25f)));
+
+using PrecisionUtilsArraysPerfTests = ::testing::TestWithParam<size_t>;
+
+TEST_P(PrecisionUtilsArraysPerfTests, DISABLED_throughput) {
+    const size_t size = GetParam();
+    const int iterations = 50;
+    std::vector<float> fp32(size, 1.5f);
+    std::vector<ie_fp16> fp16(size);
+
+    auto measure = [&](const char* name, const std::function<void()>& convert) {
+        convert();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            convert();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const double bytes = static_cast<double>(size) * (sizeof(float) + sizeof(ie_fp16)) * iterations;
+        std::cout << name << " " << size << " elements: " << bytes / elapsed.count() / 1e9 << " GB/s" << std::endl;
+    };
+
+    measure("f32tof16Arrays", [&] { PrecisionUtils::f32tof16Arrays(fp16.data(), fp32.data(), size); });
+    measure("f16tof32Arrays", [&] { PrecisionUtils::f16tof32Arrays(fp32.data(), fp16.data(), size); });
+}
+
+// 224x224x3 image, 1080p and 4K RGB frames
+INSTANTIATE_TEST_CASE_P(PrecisionUtils, PrecisionUtilsArraysPerfTests,
+                        ::testing::Values(224 * 224 * 3, 1920 * 1080 * 3, 3840 * 2160 * 3));
@@ -0,0 +1,173 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_metric_helpers.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "multi_device_exec_network.hpp"
+
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+namespace {
+
+using Duration = DeviceStatistics::Duration;
+
+class DelayedInferRequest : public InferRequestInternal {
+public:
+    DelayedInferRequest(std::chrono::milliseconds delay, std::atomic<int>& numInfers) :
+        InferRequestInternal({}, {}), _delay{delay}, _numInfers(numInfers) {}
+
+    void InferImpl() override {
+        std::this_thread::sleep_for(_delay);
+        _numInfers++;
+    }
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>&) const override {}
+
+private:
+    std::chrono::milliseconds _delay;
+    std::atomic<int>& _numInfers;
+};
+
+// Device network with one infer request which takes the given time
+class DelayedExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    explicit DelayedExecutableNetwork(std::chrono::milliseconds delay) : _delay{delay} {}
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap, OutputsDataMap) override {
+        return std::make_shared<DelayedInferRequest>(_delay, numInfers);
+    }
+
+    Parameter GetMetric(const std::string& name) const override {
+        if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+            IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, 1u);
+        }
+        THROW_IE_EXCEPTION << "Unsupported metric: " << name;
+    }
+
+    std::atomic<int> numInfers = {0};
+
+private:
+    std::chrono::milliseconds _delay;
+};
+
+}  // namespace
+
+TEST(DeviceStatisticsTest, idleDeviceCompletesInAverageLatency) {
+    DeviceStatistics statistics;
+    statistics.SetNumRequests(2);
+    ASSERT_EQ(Duration::zero(), statistics.ExpectedCompletion());
+
+    statistics.OnStart();
+    statistics.OnComplete(Duration{800});
+    ASSERT_EQ(Duration{800}, statistics.ExpectedCompletion());
+
+    // the next sample is taken with 1/8 weight
+    statistics.OnStart();
+    statistics.OnComplete(Duration{1600});
+    ASSERT_EQ(Duration{900}, statistics.GetAverageLatency());
+
+    // one request of two is busy, so the new one starts immediately
+    statistics.OnStart();
+    ASSERT_EQ(Duration{900}, statistics.ExpectedCompletion());
+}
+
+TEST(DeviceStatisticsTest, busyDeviceCompletesAfterWaitRounds) {
+    DeviceStatistics statistics;
+    statistics.SetNumRequests(2);
+    statistics.OnStart();
+    statistics.OnComplete(Duration{100});
+
+    statistics.OnStart();
+    statistics.OnStart();
+    ASSERT_EQ(Duration{200}, statistics.ExpectedCompletion());
+    statistics.OnQueued();
+    ASSERT_EQ(Duration{200}, statistics.ExpectedCompletion());
+    statistics.OnQueued();
+    ASSERT_EQ(Duration{300}, statistics.ExpectedCompletion());
+
+    statistics.OnDequeued();
+    statistics.OnDequeued();
+    statistics.OnCancel();
+    ASSERT_EQ(Duration{100}, statistics.ExpectedCompletion());
+}
+
+TEST(DeviceStatisticsTest, busyDeviceWithoutMeasurementsIsNotExpectedToComplete) {
+    DeviceStatistics statistics;
+    statistics.SetNumRequests(1);
+    statistics.OnStart();
+    ASSERT_EQ(Duration::max(), statistics.ExpectedCompletion());
+}
+
+class MultiSchedulingPolicyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _slow = std::make_shared<DelayedExecutableNetwork>(std::chrono::milliseconds{100});
+        _fast = std::make_shared<DelayedExecutableNetwork>(std::chrono::milliseconds{5});
+    }
+
+    // the slow device has the higher priority
+    ExecutableNetwork loadMulti(const std::string& policy) {
+        DeviceMap<ExecutableNetwork> networks{{"SLOW", make_executable_network(_slow)},
+                                              {"FAST", make_executable_network(_fast)}};
+        std::vector<DeviceInformation> devices{{"SLOW", {}, -1}, {"FAST", {}, -1}};
+        return make_executable_network(std::make_shared<MultiDeviceExecutableNetwork>(
+            networks, devices, std::unordered_map<std::string, Parameter>{
+                {MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, policy}}));
+    }
+
+    static void infer(std::vector<InferRequest>& requests) {
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+    }
+
+    std::shared_ptr<DelayedExecutableNetwork> _slow, _fast;
+};
+
+TEST_F(MultiSchedulingPolicyTest, priorityPolicyUsesIdleDeviceOfHigherPriority) {
+    auto execNet = loadMulti(MultiDeviceConfigParams::MULTI_POLICY_PRIORITY);
+    std::vector<InferRequest> requests{execNet.CreateInferRequest()};
+    for (int i = 0; i < 5; i++)
+        infer(requests);
+
+    ASSERT_EQ(5, _slow->numInfers.load());
+    ASSERT_EQ(0, _fast->numInfers.load());
+}
+
+TEST_F(MultiSchedulingPolicyTest, earliestCompletionPolicyRoutesRequestsToFasterDevice) {
+    auto execNet = loadMulti(MultiDeviceConfigParams::MULTI_POLICY_EARLIEST_COMPLETION);
+    std::vector<InferRequest> single{execNet.CreateInferRequest()};
+    // the first request is given to the device of higher priority as nothing is measured yet,
+    // the next one to the unmeasured idle device
+    infer(single);
+    infer(single);
+    ASSERT_EQ(1, _slow->numInfers.load());
+    ASSERT_EQ(1, _fast->numInfers.load());
+
+    for (int i = 0; i < 5; i++)
+        infer(single);
+    ASSERT_EQ(1, _slow->numInfers.load());
+    ASSERT_EQ(6, _fast->numInfers.load());
+
+    // the fast device is busy, but completes the queued requests before the idle slow device
+    std::vector<InferRequest> concurrent;
+    for (int i = 0; i < 4; i++)
+        concurrent.push_back(execNet.CreateInferRequest());
+    infer(concurrent);
+    ASSERT_EQ(1, _slow->numInfers.load());
+    ASSERT_EQ(10, _fast->numInfers.load());
+}
@@ -17,6 +17,7 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
@@ -143,6 +144,20 @@ std::vector<test::Mat> to_test(std::vector<cv::Mat>& mats)
 
 test::Rect to_test(cv::Rect& rect) { return {rect.x, rect.y, rect.width, rect.height}; }
 
+// FP32 to BF16 with round to nearest even, BF16 values are stored in CV_16S matrices
+void toBF16Reference(const cv::Mat& src, cv::Mat& dst)
+{
+    CV_Assert(src.type() == CV_32FC1 && dst.type() == CV_16SC1 && src.size() == dst.size());
+    for (int y = 0; y < src.rows; y++) {
+        for (int x = 0; x < src.cols; x++) {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &src.at<float>(y, x), sizeof(bits));
+            bits += 0x7fff + ((bits >> 16) & 1);
+            dst.at<int16_t>(y, x) = static_cast<int16_t>(bits >> 16);
+        }
+    }
+}
+
 cv::ColorConversionCodes toCvtColorCode(InferenceEngine::ColorFormat in,
                                      InferenceEngine::ColorFormat out) {
     using namespace InferenceEngine;
@@ -659,6 +674,56 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(NormalizePlaneTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    int out_depth     = std::get<1>(params);
+    float mean        = std::get<2>(params).first;
+    float scale       = std::get<2>(params).second;
+    cv::Size sz       = std::get<3>(params);
+    double tolerance  = std::get<4>(params);
+
+    const int out_type = CV_MAKETYPE(out_depth,1);
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, out_type);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    NormalizePlaneComputation nc(to_test(in_mat1), to_test(out_mat_gapi), out_mat_gapi.depth(), mean, scale);
+    nc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ nc.apply(); },
+        400, "NormalizePlane GAPI %s to %s %dx%d", depthToString(in_mat1.depth()).c_str(), depthToString(out_mat_gapi.depth()).c_str(), sz.width, sz.height);
+
+    // the same job done by a precision conversion followed by separate mean and scale passes
+    cv::Mat converted(sz, out_type);
+    ConvertDepthComputation cc(to_test(in_mat1), to_test(converted), out_depth);
+    cc.warmUp();
+    test_ms([&](){ cc.apply(); cv::subtract(converted, mean, converted); cv::multiply(converted, scale, converted); },
+        400, "NormalizePlane multi-pass %s to %s %dx%d", depthToString(in_mat1.depth()).c_str(), depthToString(out_mat_gapi.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        cv::Mat normalized;
+        in_mat1.convertTo(normalized, CV_32F);
+        cv::subtract(normalized, mean, normalized);
+        cv::multiply(normalized, scale, normalized);
+        if (out_depth == CV_16S) {
+            toBF16Reference(normalized, out_mat_ocv);
+        } else {
+            normalized.copyTo(out_mat_ocv);
+        }
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        // for BF16 output the tolerance is the distance of bit patterns, i.e. units in the last place
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -735,6 +800,92 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(PreprocGraphCacheTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    int type = 0;
+    std::vector<cv::Size> in_sizes;
+    cv::Size out_size;
+    double tolerance = 0.0;
+    std::tie(type, in_sizes, out_size, tolerance) = GetParam();
+
+    const int depth = CV_MAT_DEPTH(type);
+    CV_Assert(CV_8U == depth || CV_32F == depth);
+    const Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    const size_t channels = CV_MAT_CN(type);
+
+    // inputs of different resolutions, e.g. from several cameras
+    std::vector<cv::Mat> in_mats;
+    std::vector<Blob::Ptr> in_blobs;
+    for (const auto& sz : in_sizes) {
+        in_mats.emplace_back(sz, type);
+        cv::randu(in_mats.back(), cv::Scalar::all(0), cv::Scalar::all(255));
+        TensorDesc in_desc(precision, {1, channels, size_t(sz.height), size_t(sz.width)}, Layout::NHWC);
+        in_blobs.push_back(make_blob_with_precision(in_desc, in_mats.back().data));
+    }
+
+    cv::Mat out_mat(out_size, type);
+    TensorDesc out_desc(precision, {1, channels, size_t(out_size.height), size_t(out_size.width)}, Layout::NHWC);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    // pre-processing of two infer requests of one network
+    SharedPreProcessGraphCache cache;
+    PreProcessDataPtr first = CreatePreprocDataHelper();
+    PreProcessDataPtr second = CreatePreprocDataHelper();
+    cache.attach(**first);
+    cache.attach(**second);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    auto run = [&](PreProcessDataPtr& preprocess, size_t i) {
+        preprocess->setRoiBlob(in_blobs[i]);
+        preprocess->execute(out_blob, info, false);
+    };
+
+    // the first request compiles a graph per resolution once and reuses them afterwards
+    const size_t rounds = 3;
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < in_blobs.size(); i++) {
+            run(first, i);
+
+            cv::Mat out_mat_ocv;
+            cv::resize(in_mats[i], out_mat_ocv, out_size, 0, 0, cv::INTER_LINEAR);
+            EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+        }
+    }
+
+    size_t hits = 0, misses = 0;
+    first->getGraphCacheStats(hits, misses);
+    EXPECT_EQ(in_blobs.size(), misses);
+    EXPECT_EQ((rounds - 1) * in_blobs.size(), hits);
+
+    // the second request reuses graphs of the first one except the one the first one still holds
+    for (size_t i = 0; i < in_blobs.size(); i++) {
+        run(second, i);
+    }
+    second->getGraphCacheStats(hits, misses);
+    EXPECT_EQ(1u, misses);
+    EXPECT_EQ(in_blobs.size() - 1, hits);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ for (size_t i = 0; i < in_blobs.size(); i++) run(first, i); },
+            100, "Preproc graph cache %s %zu resolutions -> %dx%d",
+            typeToString(type).c_str(), in_sizes.size(), out_size.width, out_size.height);
+
+    // the same without any graphs to reuse
+    test_ms([&](){
+                for (size_t i = 0; i < in_blobs.size(); i++) {
+                    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+                    run(preprocess, i);
+                }
+            },
+            100, "Preproc no graph cache %s %zu resolutions -> %dx%d",
+            typeToString(type).c_str(), in_sizes.size(), out_size.width, out_size.height);
+#endif
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
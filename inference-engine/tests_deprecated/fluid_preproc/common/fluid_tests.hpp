@@ -10,6 +10,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 struct ResizeTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 struct ResizeRGB8UTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 struct SplitTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
@@ -25,6 +27,13 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct NormalizePlaneTestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            int,  // output matrix depth
+                            std::pair<float, float>,  // mean and scale
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
@@ -48,6 +57,12 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct PreprocGraphCacheTestIE: public TestParams<std::tuple<int,  // matrix type
+                                                             std::vector<cv::Size>,  // input sizes to alternate
+                                                             cv::Size,  // output size
+                                                             double>>  // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
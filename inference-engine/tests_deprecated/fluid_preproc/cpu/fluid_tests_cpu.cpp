@@ -183,6 +183,31 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(NormalizePlaneFluid, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(CV_32F),
+                                Values(std::make_pair(0.f, 1.f),
+                                       std::make_pair(127.5f, 1.f / 127.5f),
+                                       std::make_pair(103.94f, 0.017f)),
+                                Values(cv::Size(3840, 2160),
+                                       cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 113,   71)),
+                                Values(1e-5)));
+
+// BF16 output is stored in CV_16S, the tolerance is in BF16 units in the last place
+INSTANTIATE_TEST_CASE_P(NormalizePlaneBF16Fluid, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(CV_16S),
+                                Values(std::make_pair(0.f, 1.f),
+                                       std::make_pair(127.5f, 1.f / 127.5f),
+                                       std::make_pair(103.94f, 0.017f)),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 113,   71)),
+                                Values(1)));
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
@@ -225,6 +250,14 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(PreprocGraphCacheFluid, PreprocGraphCacheTestIE,
+                        Combine(Values(CV_8UC3),
+                                Values(std::vector<cv::Size>{cv::Size(1920, 1080),
+                                                             cv::Size(1280,  720),
+                                                             cv::Size( 640,  480)}),
+                                Values(cv::Size(300, 300)),
+                                Values(4))); // error not more than 4 unit
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
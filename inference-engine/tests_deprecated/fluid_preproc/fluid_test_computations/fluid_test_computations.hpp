@@ -104,4 +104,10 @@ public:
     ConvertDepthComputation(test::Mat inMat, test::Mat outMat, int depth);
 };
 
+class FLUID_COMPUTATION_VISIBILITY NormalizePlaneComputation : public FluidComputation
+{
+public:
+    NormalizePlaneComputation(test::Mat inMat, test::Mat outMat, int depth, float mean, float scale);
+};
+
 #endif // FLUID_TEST_COMPUTATIONS_HPP
@@ -0,0 +1,213 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// The global operator new is replaced for the whole binary, so these tests are built as a separate target
+
+#include "test_graph.hpp"
+
+#include <ie_core.hpp>
+#include "tests_common.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+namespace {
+// allocations through the global operator new are counted while enabled, the plugin is linked into the tests
+std::atomic<bool> countAllocations(false);
+std::atomic<size_t> allocationsCount(0);
+}  // namespace
+
+void* operator new(size_t size) {
+    if (countAllocations)
+        allocationsCount++;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+class MKLDNNGenericNodeAllocationsTests : public TestsCommon {
+protected:
+    // Input dictionary -> [Abs -> Gather -> Sin] or [Gather] -> Output
+    static std::string getModel(bool withUnaryLayers) {
+        std::string dictionaryInput = R"V0G0N(
+        <layer name="dictionary" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="indexes" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        std::string gather = R"V0G0N(
+        <layer name="gather" id="3" type="Gather" precision="FP32">
+            <data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        std::string abs = R"V0G0N(
+        <layer name="abs" id="2" type="Abs" precision="FP32">
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        std::string sin = R"V0G0N(
+        <layer name="sin" id="4" type="Sin" precision="FP32">
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+        std::string model = R"V0G0N(<net Name="Extension_layers" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + dictionaryInput + gather;
+        if (withUnaryLayers) {
+            model += abs + sin + R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+    </edges>
+</net>)V0G0N";
+        } else {
+            model += R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+    </edges>
+</net>)V0G0N";
+        }
+        return model;
+    }
+
+    // Returns the number of allocations made by each of the inferences after the first one
+    std::vector<size_t> inferAndCountAllocations(bool withUnaryLayers, int iterations) {
+        InferenceEngine::Core core;
+        InferenceEngine::CNNNetwork network = core.ReadNetwork(getModel(withUnaryLayers), InferenceEngine::Blob::CPtr());
+
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(network);
+
+        size_t genericNodes = 0;
+        for (auto &node : graph.getNodes()) {
+            if (node->getType() == MKLDNNPlugin::Generic)
+                genericNodes++;
+        }
+        EXPECT_EQ(withUnaryLayers ? 3u : 1u, genericNodes);
+
+        InferenceEngine::Blob::Ptr dictionary =
+                InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {2, 16, 8}, InferenceEngine::CHW});
+        dictionary->allocate();
+        fill_data(dictionary->buffer(), dictionary->size());
+        std::vector<float> indexesData = {0.f, 3.f, 15.f, 7.f, 7.f, 1.f};
+        InferenceEngine::Blob::Ptr indexes =
+                InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {6}, InferenceEngine::C}, indexesData.data());
+
+        InferenceEngine::BlobMap srcs;
+        srcs["dictionary"] = dictionary;
+        srcs["indexes"] = indexes;
+
+        InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+
+        InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+        dst_ref.allocate();
+        const float *src_data = dictionary->cbuffer().as<const float *>();
+        for (size_t n = 0; n < 2; n++) {
+            for (size_t i = 0; i < indexesData.size(); i++) {
+                for (size_t c = 0; c < 8; c++) {
+                    const float value = src_data[(n * 16 + static_cast<size_t>(indexesData[i])) * 8 + c];
+                    dst_ref.data()[(n * indexesData.size() + i) * 8 + c] = withUnaryLayers ? sinf(std::fabs(value)) : value;
+                }
+            }
+        }
+        compare(*output, dst_ref);
+
+        // the inputs stay in the graph memory, so the whole graph is executed without the test helpers
+        std::vector<size_t> allocations(iterations);
+        for (auto &count : allocations) {
+            allocationsCount = 0;
+            countAllocations = true;
+            graph.MKLDNNPlugin::MKLDNNGraph::Infer();
+            countAllocations = false;
+            count = allocationsCount.load();
+        }
+        return allocations;
+    }
+};
+
+TEST_F(MKLDNNGenericNodeAllocationsTests, ExtensionLayersDoNotAllocateOnInfer) {
+    constexpr int iterations = 10;
+    auto referenceAllocations = inferAndCountAllocations(false, iterations);
+    auto allocations = inferAndCountAllocations(true, iterations);
+
+    // the graph itself may allocate (e.g. on stream creation), but two more generic nodes add nothing to it
+    for (int i = 0; i < iterations; i++) {
+        ASSERT_EQ(referenceAllocations.back(), referenceAllocations[i]);
+        ASSERT_EQ(allocations.back(), allocations[i]);
+    }
+    ASSERT_EQ(referenceAllocations.back(), allocations.back());
+}
@@ -178,6 +178,7 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
 static std::map<std::string, std::string> configure() {
     const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
     const bool isFPGA = FLAGS_d.find("FPGA") != std::string::npos;
+    const bool isCPU = FLAGS_d.find("CPU") != std::string::npos;
 
     auto config = parseConfigFile();
 
@@ -205,6 +206,11 @@ IE_SUPPRESS_DEPRECATED_END
         }
     }
 
+    if (isCPU) {
+        // the CPU plugin keeps the network for export only on request
+        config[InferenceEngine::PluginConfigParams::KEY_CPU_EXPORTABLE] = InferenceEngine::PluginConfigParams::YES;
+    }
+
     return config;
 }
 
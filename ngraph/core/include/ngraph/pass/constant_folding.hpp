@@ -26,19 +26,31 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *        In parallel mode nodes which have only constant inputs are evaluated in
+         *        parallel first, wave by wave, and reference kernels of folded nodes use several
+         *        threads. Otherwise folding and the kernels are serial. The mode is also enabled by
+         *        NGRAPH_PARALLEL_CONSTANT_FOLDING environment variable.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+            explicit ConstantFolding(bool parallel = false);
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
+            /// \brief Folds independent nodes with constant inputs in parallel. Replacements
+            /// of each wave make their consumers ready for the next one.
+            bool parallel_folding(const std::shared_ptr<ngraph::Function>& f);
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+
+            bool m_parallel;
         };
     } // namespace pass
 } // namespace ngraph
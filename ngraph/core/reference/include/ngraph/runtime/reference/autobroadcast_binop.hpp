@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -95,6 +97,144 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                /// \brief Serial NUMPY broadcasting of autobroadcast_binop.
+                template <typename T, typename U, typename Functor>
+                void numpy_autobroadcast(const T* arg0,
+                                         const T* arg1,
+                                         U* out,
+                                         const Shape& arg0_shape,
+                                         const Shape& arg1_shape,
+                                         Functor elementwise_functor)
+                {
+                    // We'll be using CoordinateTransform to handle the broadcasting. The general
+                    // procedure is as follows:
+                    //
+                    // (1) Left pad the shorter of the two shapes with ones.
+                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
+                    //     indices.
+                    // (3) Using CoordinateTransform, broadcast both args to the final output
+                    //     shape. The "broadcasted axes" will be those that were squeezed in step
+                    //     2.
+                    //
+                    // Example:
+                    //
+                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
+                    //    -----------  ------------  ----------------------------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
+                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //                   |  |  |
+                    //                   v  v  v
+                    //                 Output shape
+                    //                 ------------
+                    //                 [ 3, 2, 6]
+
+                    size_t const shape_rank =
+                        std::max(arg0_shape.size(), arg1_shape.size()) + 1;
+
+                    // TODO: Use compiler-specific alloca() or variable-length array
+                    std::vector<size_t> tmp(shape_rank * 2);
+
+                    size_t* strides0 = tmp.data();
+                    size_t* strides1 = tmp.data() + shape_rank;
+
+                    row_major_strides(arg0_shape, strides0, shape_rank);
+                    row_major_strides(arg1_shape, strides1, shape_rank);
+
+                    size_t const padding0 = shape_rank - arg0_shape.size();
+                    size_t const padding1 = shape_rank - arg1_shape.size();
+
+                    Shape output_shape(shape_rank, 0);
+
+                    size_t axis = 0;
+
+                    for (size_t i = 0; i < shape_rank; i++)
+                    {
+                        auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+                        auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+
+                        output_shape[i] = std::max(dim0, dim1);
+
+                        if (dim0 != dim1)
+                            axis = std::max(axis, i);
+                    }
+#if 0
+                    // Universal function without optimisations
+                    CoordinateTransformBasic arg0_transform(arg0_shape);
+                    CoordinateTransformBasic arg1_transform(arg1_shape);
+                    U *dst = out;
+
+                    for(CoordinateIterator it(output_shape),
+                        ite = CoordinateIterator::end();
+                        it != ite;
+                        ++it)
+                    {
+                        const Coordinate& output_coord = *it;
+                        size_t const idx0 = arg0_transform.index(output_coord);
+                        size_t const idx1 = arg1_transform.index(output_coord);
+                        *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
+                    }
+#else
+
+                    if (axis == 0)
+                    {
+                        for (size_t i = 0, end = strides0[0]; i < end; ++i)
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                    }
+                    else if (strides0[axis] == 1 &&
+                             value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
+                    {
+                        axis = calculate_fixed_axis(axis, strides0);
+
+                        numpy_autobroadcast_binop<0, 1>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides1[axis],
+                                                        elementwise_functor);
+                    }
+                    else if (strides1[axis] == 1 &&
+                             value_with_padding_or(arg1_shape, padding1, axis, 1) == 1)
+                    {
+                        axis = calculate_fixed_axis(axis, strides1);
+
+                        numpy_autobroadcast_binop<1, 0>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides0[axis],
+                                                        elementwise_functor);
+                    }
+                    else
+                        numpy_autobroadcast_binop<1, 1>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides0[axis],
+                                                        elementwise_functor);
+#endif
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -126,141 +266,75 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape),
+                                 parallel_grain,
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                     }
+                                 });
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
-                    //
-                    // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
-                    //
-                    // Example:
-                    //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
-                    //                   |  |  |
-                    //                   v  v  v
-                    //                 Output shape
-                    //                 ------------
-                    //                 [ 3, 2, 6]
+                    // Independent slices of the output along its first non-unit axis are
+                    // computed in parallel, each one by the serial broadcasting routine.
                     {
                         using namespace internal;
 
-                        size_t const shape_rank =
-                            std::max(arg0_shape.size(), arg1_shape.size()) + 1;
-
-                        // TODO: Use compiler-specific alloca() or variable-length array
-                        std::vector<size_t> tmp(shape_rank * 2);
-
-                        size_t* strides0 = tmp.data();
-                        size_t* strides1 = tmp.data() + shape_rank;
-
-                        row_major_strides(arg0_shape, strides0, shape_rank);
-                        row_major_strides(arg1_shape, strides1, shape_rank);
-
-                        size_t const padding0 = shape_rank - arg0_shape.size();
-                        size_t const padding1 = shape_rank - arg1_shape.size();
-
-                        Shape output_shape(shape_rank, 0);
-
-                        size_t axis = 0;
-
-                        for (size_t i = 0; i < shape_rank; i++)
+                        const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                        const size_t padding0 = rank - arg0_shape.size();
+                        const size_t padding1 = rank - arg1_shape.size();
+                        Shape output_shape(rank);
+                        for (size_t i = 0; i < rank; i++)
                         {
-                            auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
-                            auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
-
-                            output_shape[i] = std::max(dim0, dim1);
-
-                            if (dim0 != dim1)
-                                axis = std::max(axis, i);
+                            output_shape[i] =
+                                std::max(value_with_padding_or(arg0_shape, padding0, i, 1),
+                                         value_with_padding_or(arg1_shape, padding1, i, 1));
                         }
-#if 0
-                        // Universal function without optimisations
-                        CoordinateTransformBasic arg0_transform(arg0_shape);
-                        CoordinateTransformBasic arg1_transform(arg1_shape);
-                        U *dst = out;
-
-                        for(CoordinateIterator it(output_shape),
-                            ite = CoordinateIterator::end();
-                            it != ite;
-                            ++it)
-                        {
-                            const Coordinate& output_coord = *it;
-                            size_t const idx0 = arg0_transform.index(output_coord);
-                            size_t const idx1 = arg1_transform.index(output_coord);
-                            *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
-                        }
-#else
 
-                        if (axis == 0)
+                        const size_t axis = std::find_if(output_shape.begin(),
+                                                         output_shape.end(),
+                                                         [](size_t dim) { return dim != 1; }) -
+                                            output_shape.begin();
+                        if (axis == rank || shape_size(output_shape) < 2 * parallel_grain)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
-                        }
-                        else if (strides0[axis] == 1 &&
-                                 value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
-                        {
-                            axis = calculate_fixed_axis(axis, strides0);
-
-                            numpy_autobroadcast_binop<0, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides1[axis],
-                                                            elementwise_functor);
-                        }
-                        else if (strides1[axis] == 1 &&
-                                 value_with_padding_or(arg1_shape, padding1, axis, 1) == 1)
-                        {
-                            axis = calculate_fixed_axis(axis, strides1);
-
-                            numpy_autobroadcast_binop<1, 0>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
+                            numpy_autobroadcast(
+                                arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+                            break;
                         }
-                        else
-                            numpy_autobroadcast_binop<1, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
-#endif
+
+                        // shapes of the slices keep the dimensions after the split axis
+                        auto slice_shape = [&](const Shape& shape, size_t padding) {
+                            return axis + 1 > padding ? Shape(shape.begin() + axis + 1 - padding,
+                                                              shape.end())
+                                                      : shape;
+                        };
+                        const Shape slice_shape0 = slice_shape(arg0_shape, padding0);
+                        const Shape slice_shape1 = slice_shape(arg1_shape, padding1);
+                        const size_t step0 =
+                            value_with_padding_or(arg0_shape, padding0, axis, 1) == 1
+                                ? 0
+                                : shape_size(slice_shape0);
+                        const size_t step1 =
+                            value_with_padding_or(arg1_shape, padding1, axis, 1) == 1
+                                ? 0
+                                : shape_size(slice_shape1);
+                        const size_t slice_size =
+                            shape_size(Shape(output_shape.begin() + axis + 1, output_shape.end()));
+
+                        parallel_for(output_shape[axis],
+                                     std::max<size_t>(parallel_grain / slice_size, 1),
+                                     [&](size_t begin, size_t end) {
+                                         for (size_t i = begin; i < end; i++)
+                                         {
+                                             numpy_autobroadcast(arg0 + i * step0,
+                                                                 arg1 + i * step1,
+                                                                 out + i * slice_size,
+                                                                 slice_shape0,
+                                                                 slice_shape1,
+                                                                 elementwise_functor);
+                                         }
+                                     });
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,20 +30,24 @@ namespace ngraph
             typename std::enable_if<!std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<TO>(arg[i]);
-                }
+                parallel_for(count, parallel_grain, [arg, out](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = static_cast<TO>(arg[i]);
+                    }
+                });
             }
 
             template <typename TI, typename TO>
             typename std::enable_if<std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-                }
+                parallel_for(count, parallel_grain, [arg, out](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+                    }
+                });
             }
 
         } // namespace reference
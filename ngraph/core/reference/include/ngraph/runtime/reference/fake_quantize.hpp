@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cfenv>
 #include <cmath>
 #include <cstddef>
-#include <numeric>
-#include <utility>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -30,74 +33,45 @@ namespace ngraph
     {
         namespace reference
         {
-            namespace
+            namespace fake_quantize_details
             {
-                std::vector<size_t>
-                    calc_broadcast_index_offset(const std::vector<size_t>& memory_offsets,
-                                                const std::vector<size_t>& broadcast_shape)
+                /// \brief Strides of a range tensor over the dimensions of the data, 0 along
+                ///        the broadcast ones. The range shape is aligned to the trailing
+                ///        dimensions of the data.
+                inline std::vector<size_t> calc_broadcast_strides(const Shape& arg_shape,
+                                                                  const Shape& range_shape)
                 {
-                    std::vector<size_t> broadcast_offsets(broadcast_shape.size(), 0);
-                    for (int i = broadcast_shape.size() - 2; i >= 0; --i)
+                    std::vector<size_t> strides(arg_shape.size(), 0);
+                    if (shape_size(range_shape) <= 1)
                     {
-                        if (broadcast_shape[i] == 1)
-                        {
-                            broadcast_offsets[i] = memory_offsets[i];
-                        }
-                    }
-                    if (!std::all_of(broadcast_shape.begin(),
-                                     broadcast_shape.end(),
-                                     [](size_t i) { return i == 1; }) &&
-                        broadcast_shape.back() == 1)
-                    {
-                        broadcast_offsets[broadcast_offsets.size() - 1] = 1;
+                        return strides;
                     }
-                    if (broadcast_shape.back() == 1)
+                    size_t stride = 1;
+                    for (size_t i = range_shape.size(); i > 0; --i)
                     {
-                        for (int i = broadcast_shape.size() - 1; i >= 0; --i)
+                        if (range_shape[i - 1] != 1)
                         {
-                            if (broadcast_shape[i] != 1)
-                            {
-                                broadcast_offsets[i] = memory_offsets[i] - 1;
-                                break;
-                            }
+                            strides[arg_shape.size() - range_shape.size() + i - 1] = stride;
                         }
+                        stride *= range_shape[i - 1];
                     }
-                    return broadcast_offsets;
-                }
-
-                size_t calc_full_broadcast_offset(const std::vector<size_t>& current_dims,
-                                                  const std::vector<size_t>& offsets)
-                {
-                    size_t full_index_offset = 0;
-                    for (size_t i = 0; i < current_dims.size(); ++i)
-                    {
-                        full_index_offset += offsets[i] * current_dims[i];
-                    }
-                    return full_index_offset;
+                    return strides;
                 }
 
-                void align_shape_sizes(Shape& shape, size_t target_size)
+                template <typename T>
+                T quantize(T arg, T in_low, T in_high, T out_low, T out_high, size_t levels)
                 {
-                    for (size_t i = 0; i < shape.size() - target_size; ++i)
+                    if (arg <= std::min(in_low, in_high))
                     {
-                        shape.insert(shape.begin(), 1);
+                        return out_low;
                     }
-                }
-
-                void increment_current_dim(std::vector<size_t>& current_dims,
-                                           const std::vector<size_t>& shape,
-                                           size_t incremented_dim_number)
-                {
-                    current_dims[incremented_dim_number] += 1;
-                    if (current_dims[incremented_dim_number] == shape[incremented_dim_number] &&
-                        incremented_dim_number != 0)
+                    else if (arg > std::max(in_low, in_high))
                     {
-                        for (size_t i = incremented_dim_number; i < shape.size(); ++i)
-                        {
-                            current_dims[i] = 0;
-                        }
-                        increment_current_dim(current_dims, shape, incremented_dim_number - 1);
+                        return out_high;
                     }
+                    return nearbyint((arg - in_low) / (in_high - in_low) * (levels - 1)) /
+                               (levels - 1) * (out_high - out_low) +
+                           out_low;
                 }
             }
 
@@ -109,18 +83,13 @@ namespace ngraph
                                const T* out_high,
                                T* out,
                                const Shape& arg_shape,
-                               const Shape& _in_low_shape,
-                               const Shape& _in_high_shape,
-                               const Shape& _out_low_shape,
-                               const Shape& _out_high_shape,
+                               const Shape& in_low_shape,
+                               const Shape& in_high_shape,
+                               const Shape& out_low_shape,
+                               const Shape& out_high_shape,
                                size_t levels)
             {
-                auto initial_round_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
-                Shape in_low_shape(_in_low_shape);
-                Shape in_high_shape(_in_high_shape);
-                Shape out_low_shape(_out_low_shape);
-                Shape out_high_shape(_out_high_shape);
+                using namespace fake_quantize_details;
 
                 if (in_low_shape.size() > arg_shape.size() ||
                     in_high_shape.size() > arg_shape.size() ||
@@ -133,114 +102,78 @@ namespace ngraph
                         std::to_string(arg_shape.size()));
                 }
 
-                std::vector<size_t> arg_memory_offsets(arg_shape.size(), 0);
-                for (int i = arg_shape.size() - 2; i >= 0; i--)
+                // The data is processed by rows of its innermost dimension, offsets of the
+                // ranges are computed once per row. Ranges are usually per channel, then they
+                // are constant along a row.
+                const size_t rank = arg_shape.size();
+                const size_t row = rank == 0 ? 1 : arg_shape.back();
+                const size_t rows = row == 0 ? 0 : shape_size(arg_shape) / row;
+                const T* ranges[] = {in_low, in_high, out_low, out_high};
+                const std::vector<size_t> strides[] = {
+                    calc_broadcast_strides(arg_shape, in_low_shape),
+                    calc_broadcast_strides(arg_shape, in_high_shape),
+                    calc_broadcast_strides(arg_shape, out_low_shape),
+                    calc_broadcast_strides(arg_shape, out_high_shape)};
+                size_t row_steps[4] = {0, 0, 0, 0};
+                bool constant_in_row = true;
+                for (size_t r = 0; r < 4 && rank > 0; ++r)
                 {
-                    arg_memory_offsets[i] = std::accumulate(
-                        arg_shape.begin() + i + 1, arg_shape.end(), 1, std::multiplies<size_t>());
+                    row_steps[r] = strides[r][rank - 1];
+                    constant_in_row = constant_in_row && row_steps[r] == 0;
                 }
-                align_shape_sizes(in_low_shape, arg_shape.size());
-                align_shape_sizes(in_high_shape, arg_shape.size());
-                align_shape_sizes(out_low_shape, arg_shape.size());
-                align_shape_sizes(out_high_shape, arg_shape.size());
-
-                std::vector<size_t> in_low_offsets, in_high_offsets, out_low_offsets,
-                    out_high_offsets;
-                bool in_low_trivial_broadcast = false;
-                bool in_high_trivial_broadcast = false;
-                bool out_low_trivial_broadcast = false;
-                bool out_high_trivial_broadcast = false;
-                bool in_low_aligned = false;
-                bool in_high_aligned = false;
-                bool out_low_aligned = false;
-                bool out_high_aligned = false;
 
-                auto check_trivial_broadcast =
-                    [&arg_shape, &arg_memory_offsets](Shape& shape_to_check,
-                                                      std::vector<size_t>& target_offsets,
-                                                      bool& trivial_broadcast,
-                                                      bool& aligned) {
-                        if (shape_size(shape_to_check) == 1 || shape_size(shape_to_check) == 0)
+                parallel_for(
+                    rows, std::max<size_t>(parallel_grain / row, 1), [&](size_t begin, size_t end) {
+                        // the rounding mode is a property of the thread
+                        const auto initial_round_mode = std::fegetround();
+                        std::fesetround(FE_TONEAREST);
+                        for (size_t i = begin; i < end; ++i)
                         {
-                            trivial_broadcast = true;
-                        }
-                        else if (shape_to_check == arg_shape)
-                        {
-                            aligned = true;
-                        }
-                        else
-                        {
-                            target_offsets =
-                                calc_broadcast_index_offset(arg_memory_offsets, shape_to_check);
-                        }
-                    };
-                check_trivial_broadcast(
-                    in_low_shape, in_low_offsets, in_low_trivial_broadcast, in_low_aligned);
-                check_trivial_broadcast(
-                    in_high_shape, in_high_offsets, in_high_trivial_broadcast, in_high_aligned);
-                check_trivial_broadcast(
-                    out_low_shape, out_low_offsets, out_low_trivial_broadcast, out_low_aligned);
-                check_trivial_broadcast(
-                    out_high_shape, out_high_offsets, out_high_trivial_broadcast, out_high_aligned);
-
-                std::vector<size_t> current_dim(arg_shape.size(), 0);
+                            size_t offsets[4] = {0, 0, 0, 0};
+                            for (size_t axis = rank > 0 ? rank - 1 : 0, index = i; axis > 0;
+                                 --axis)
+                            {
+                                const size_t coord = index % arg_shape[axis - 1];
+                                index /= arg_shape[axis - 1];
+                                for (size_t r = 0; r < 4; ++r)
+                                {
+                                    offsets[r] += coord * strides[r][axis - 1];
+                                }
+                            }
 
-                auto get_value = [&current_dim](bool is_trivial_broadcast,
-                                                bool is_aligned,
-                                                const T* data,
-                                                size_t idx,
-                                                const std::vector<size_t>& offsets) {
-                    T val;
-                    if (is_aligned)
-                    {
-                        val = data[idx];
-                    }
-                    else if (is_trivial_broadcast)
-                    {
-                        val = data[0];
-                    }
-                    else
-                    {
-                        size_t index_offset = calc_full_broadcast_offset(current_dim, offsets);
-                        if (index_offset != 0)
-                        {
-                            NGRAPH_CHECK(idx >= index_offset, "Incorrect index offset value!");
+                            const T* src = arg + i * row;
+                            T* dst = out + i * row;
+                            if (constant_in_row)
+                            {
+                                const T in_low_val = in_low[offsets[0]];
+                                const T in_high_val = in_high[offsets[1]];
+                                const T out_low_val = out_low[offsets[2]];
+                                const T out_high_val = out_high[offsets[3]];
+                                for (size_t j = 0; j < row; ++j)
+                                {
+                                    dst[j] = quantize(src[j],
+                                                      in_low_val,
+                                                      in_high_val,
+                                                      out_low_val,
+                                                      out_high_val,
+                                                      levels);
+                                }
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < row; ++j)
+                                {
+                                    dst[j] = quantize(src[j],
+                                                      ranges[0][offsets[0] + j * row_steps[0]],
+                                                      ranges[1][offsets[1] + j * row_steps[1]],
+                                                      ranges[2][offsets[2] + j * row_steps[2]],
+                                                      ranges[3][offsets[3] + j * row_steps[3]],
+                                                      levels);
+                                }
+                            }
                         }
-                        val = data[idx - index_offset];
-                    }
-                    return val;
-                };
-                for (size_t i = 0; i < shape_size(arg_shape); ++i)
-                {
-                    T in_low_val = get_value(
-                        in_low_trivial_broadcast, in_low_aligned, in_low, i, in_low_offsets);
-                    T in_high_val = get_value(
-                        in_high_trivial_broadcast, in_high_aligned, in_high, i, in_high_offsets);
-                    T out_low_val = get_value(
-                        out_low_trivial_broadcast, out_low_aligned, out_low, i, out_low_offsets);
-                    T out_high_val = get_value(out_high_trivial_broadcast,
-                                               out_high_aligned,
-                                               out_high,
-                                               i,
-                                               out_high_offsets);
-                    if (arg[i] <= std::min(in_low_val, in_high_val))
-                    {
-                        out[i] = out_low_val;
-                    }
-                    else if (arg[i] > std::max(in_low_val, in_high_val))
-                    {
-                        out[i] = out_high_val;
-                    }
-                    else
-                    {
-                        out[i] = nearbyint((arg[i] - in_low_val) / (in_high_val - in_low_val) *
-                                           (levels - 1)) /
-                                     (levels - 1) * (out_high_val - out_low_val) +
-                                 out_low_val;
-                    }
-                    increment_current_dim(current_dim, arg_shape, arg_shape.size() - 1);
-                }
-                std::fesetround(initial_round_mode);
+                        std::fesetround(initial_round_mode);
+                    });
             }
         }
     }
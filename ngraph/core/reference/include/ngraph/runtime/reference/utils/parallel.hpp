@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Number of elements below which element-wise kernels do not spawn threads.
+            constexpr size_t parallel_grain = 1 << 16;
+
+            namespace details
+            {
+                inline bool& parallel_kernels_enabled()
+                {
+                    static thread_local bool enabled = false;
+                    return enabled;
+                }
+
+                inline bool& in_parallel_region()
+                {
+                    static thread_local bool in_region = false;
+                    return in_region;
+                }
+
+                class ParallelRegionGuard
+                {
+                public:
+                    ParallelRegionGuard()
+                        : m_prev(in_parallel_region())
+                    {
+                        in_parallel_region() = true;
+                    }
+                    ~ParallelRegionGuard() { in_parallel_region() = m_prev; }
+
+                private:
+                    bool m_prev;
+                };
+            }
+
+            /// \brief Enables parallel reference kernels on the current thread while it exists.
+            ///
+            /// Kernels are serial by default, since evaluate() may be called from threads of
+            /// plugins and applications. Parallel constant folding enables them for its run.
+            class ParallelKernelsScope
+            {
+            public:
+                ParallelKernelsScope()
+                    : m_prev(details::parallel_kernels_enabled())
+                {
+                    details::parallel_kernels_enabled() = true;
+                }
+                ~ParallelKernelsScope() { details::parallel_kernels_enabled() = m_prev; }
+                ParallelKernelsScope(const ParallelKernelsScope&) = delete;
+                ParallelKernelsScope& operator=(const ParallelKernelsScope&) = delete;
+
+            private:
+                bool m_prev;
+            };
+
+            /// \brief Maximal number of threads of the parallel reference kernels.
+            ///
+            /// Equals to the number of hardware threads unless NGRAPH_REFERENCE_THREADS
+            /// environment variable sets it. It is 1 outside of a ParallelKernelsScope and inside
+            /// a parallel region, so kernels called from parallel tasks (e.g. from parallel
+            /// constant folding) run serially.
+            inline size_t get_max_threads()
+            {
+                static const size_t max_threads = []() -> size_t {
+                    const int32_t threads = getenv_int("NGRAPH_REFERENCE_THREADS", 0);
+                    if (threads > 0)
+                        return threads;
+                    return std::max(std::thread::hardware_concurrency(), 1u);
+                }();
+                return details::parallel_kernels_enabled() && !details::in_parallel_region()
+                           ? max_threads
+                           : 1;
+            }
+
+            /// \brief Splits [0, count) into contiguous chunks of at least grain items and calls
+            ///        body(begin, end) for them in parallel, the caller thread takes the first
+            ///        chunk. An exception thrown by any chunk is rethrown after all of them finish.
+            template <typename F>
+            void parallel_for(size_t count, size_t grain, const F& body)
+            {
+                const size_t max_chunks = (count + std::max<size_t>(grain, 1) - 1) /
+                                          std::max<size_t>(grain, 1);
+                const size_t threads = std::min(get_max_threads(), max_chunks);
+                if (threads <= 1)
+                {
+                    if (count > 0)
+                        body(size_t(0), count);
+                    return;
+                }
+
+                const size_t chunk = (count + threads - 1) / threads;
+                std::exception_ptr error;
+                std::mutex error_mutex;
+                auto run_chunk = [&](size_t begin) {
+                    details::ParallelRegionGuard guard;
+                    try
+                    {
+                        body(begin, std::min(begin + chunk, count));
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                workers.reserve(threads - 1);
+                for (size_t begin = chunk; begin < count; begin += chunk)
+                    workers.emplace_back(run_chunk, begin);
+                run_chunk(0);
+                for (auto& worker : workers)
+                    worker.join();
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+    }
+}
@@ -14,238 +14,155 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cmath>
-#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        memcpy(out, in, elem_size);
-    }
-
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
-        }
-    }
+    // tiles of the blocked transpose are tile_size x tile_size elements
+    constexpr size_t tile_size = 32;
 
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Output dimensions with their strides in the input. Unit dimensions are dropped and
+    // output dimensions which stay adjacent in the input are merged, so a plain copy
+    // becomes a single dimension with the unit stride.
+    void simplify_transpose(const Shape& in_shape,
+                            const AxisVector& in_axis_order,
+                            std::vector<size_t>& dims,
+                            std::vector<size_t>& in_strides)
     {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
+        std::vector<size_t> strides(in_shape.size(), 1);
+        for (size_t i = in_shape.size(); i > 1; --i)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            strides[i - 2] = strides[i - 1] * in_shape[i - 1];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        for (auto axis : in_axis_order)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            if (in_shape[axis] == 1)
+                continue;
+            if (!dims.empty() && in_strides.back() == strides[axis] * in_shape[axis])
             {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
+                dims.back() *= in_shape[axis];
+                in_strides.back() = strides[axis];
             }
-        }
-    }
-
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            else
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
-                }
+                dims.push_back(in_shape[axis]);
+                in_strides.push_back(strides[axis]);
             }
         }
     }
 
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Offset of the row-major index over the given output dimensions.
+    size_t offset_of(size_t index,
+                     const std::vector<size_t>& dims,
+                     const std::vector<size_t>& strides,
+                     const std::vector<size_t>& axes)
     {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
+        size_t offset = 0;
+        for (auto axis = axes.rbegin(); axis != axes.rend(); ++axis)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
-                    }
-                }
-            }
+            offset += index % dims[*axis] * strides[*axis];
+            index /= dims[*axis];
         }
+        return offset;
     }
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    template <size_t ElemSize>
+    void transpose(const char* in,
+                   char* out,
+                   const std::vector<size_t>& dims,
+                   const std::vector<size_t>& in_strides)
     {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
+        const size_t rank = dims.size();
+        if (rank == 0)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            memcpy(out, in, ElemSize);
+            return;
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+        const size_t last = rank - 1;
+        if (in_strides[last] == 1)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+            // the innermost output dimension is contiguous in the input, copy it row by row
+            const size_t row = dims[last];
+            std::vector<size_t> outer(last);
+            std::iota(outer.begin(), outer.end(), 0);
+            const size_t rows = shape_size(Shape(dims.begin(), dims.begin() + last));
+            runtime::reference::parallel_for(
+                rows,
+                std::max<size_t>(runtime::reference::parallel_grain / row, 1),
+                [&](size_t begin, size_t end) {
+                    for (size_t r = begin; r < end; ++r)
                     {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
-                        }
+                        memcpy(out + r * row * ElemSize,
+                               in + offset_of(r, dims, in_strides, outer) * ElemSize,
+                               row * ElemSize);
                     }
-                }
-            }
+                });
+            return;
         }
-    }
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
+        // the innermost input dimension is the output dimension k, both it and the innermost
+        // output dimension are walked in tiles, so reads and writes stay within few cache lines
+        const size_t k = std::find(in_strides.begin(), in_strides.end(), 1) - in_strides.begin();
+        NGRAPH_CHECK(k < last, "Transpose has no contiguous input dimension");
+
+        std::vector<size_t> out_strides(rank, 1);
+        for (size_t i = last; i > 0; --i)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            out_strides[i - 1] = out_strides[i] * dims[i];
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        std::vector<size_t> outer;
+        for (size_t i = 0; i < last; ++i)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+            if (i != k)
+                outer.push_back(i);
+        }
+
+        size_t outer_count = 1;
+        for (auto axis : outer)
+            outer_count *= dims[axis];
+        const size_t k_tiles = (dims[k] + tile_size - 1) / tile_size;
+        const size_t tile_work = tile_size * dims[last];
+        runtime::reference::parallel_for(
+            outer_count * k_tiles,
+            std::max<size_t>(runtime::reference::parallel_grain / tile_work, 1),
+            [&](size_t begin, size_t end) {
+                for (size_t task = begin; task < end; ++task)
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                    const size_t o = task / k_tiles;
+                    const size_t k_begin = task % k_tiles * tile_size;
+                    const size_t k_end = std::min(k_begin + tile_size, dims[k]);
+                    const char* src = in + offset_of(o, dims, in_strides, outer) * ElemSize;
+                    char* dst = out + offset_of(o, dims, out_strides, outer) * ElemSize;
+
+                    for (size_t l_begin = 0; l_begin < dims[last]; l_begin += tile_size)
                     {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
+                        const size_t l_end = std::min(l_begin + tile_size, dims[last]);
+                        for (size_t kk = k_begin; kk < k_end; ++kk)
                         {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
+                            const char* src_row = src + kk * ElemSize;
+                            char* dst_row = dst + kk * out_strides[k] * ElemSize;
+                            for (size_t ll = l_begin; ll < l_end; ++ll)
                             {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
+                                memcpy(dst_row + ll * ElemSize,
+                                       src_row + ll * in_strides[last] * ElemSize,
+                                       ElemSize);
                             }
                         }
                     }
                 }
-            }
-        }
+            });
     }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -253,15 +170,28 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    NGRAPH_CHECK(in_shape.size() == in_axis_order.size() &&
+                 shape_size(in_shape) == shape_size(out_shape));
+    if (shape_size(in_shape) == 0)
+        return;
+
+    std::vector<size_t> dims;
+    std::vector<size_t> in_strides;
+    simplify_transpose(in_shape, in_axis_order, dims, in_strides);
+
+    switch (elem_size)
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+    case 1: transpose<1>(in, out, dims, in_strides); break;
+    case 2: transpose<2>(in, out, dims, in_strides); break;
+    case 4: transpose<4>(in, out, dims, in_strides); break;
+    case 8: transpose<8>(in, out, dims, in_strides); break;
+    default:
+        // elements of other sizes are moved as bytes of an extra innermost dimension
+        for (auto& stride : in_strides)
+            stride *= elem_size;
+        dims.push_back(elem_size);
+        in_strides.push_back(1);
+        transpose<1>(in, out, dims, in_strides);
+        break;
     }
 }
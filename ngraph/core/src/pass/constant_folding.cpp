@@ -15,18 +15,37 @@
 //*****************************************************************************
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <atomic>
+#include <memory>
+#include <unordered_set>
 #include <ngraph/op/constant.hpp>
+#include "ngraph/env_util.hpp"
+#include "ngraph/op/sink.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+ngraph::pass::ConstantFolding::ConstantFolding(bool parallel)
+    : m_parallel(parallel || getenv_bool("NGRAPH_PARALLEL_CONSTANT_FOLDING"))
+{
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = pre_calculated_values_folding(f);
+    // reference kernels are serial unless the parallel mode is requested
+    std::unique_ptr<runtime::reference::ParallelKernelsScope> parallel_kernels;
+    if (m_parallel)
+    {
+        parallel_kernels.reset(new runtime::reference::ParallelKernelsScope());
+        rewritten |= parallel_folding(f);
+    }
 
     for (const auto& node : f->get_ordered_ops())
     {
@@ -38,33 +57,7 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values()))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i)
-            {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            rewritten |= replace_outputs(node, replacements);
         }
         else
         {
@@ -82,6 +75,110 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
     return rewritten;
 }
 
+bool ngraph::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ngraph::Function>& f)
+{
+    auto is_ready = [](const std::shared_ptr<Node>& node) {
+        if (node->get_input_size() == 0 || op::is_constant(node) || op::is_output(node) ||
+            std::dynamic_pointer_cast<op::Sink>(node) ||
+            std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+        {
+            return false;
+        }
+        for (const auto& input : node->input_values())
+        {
+            if (!op::is_constant(input.get_node()))
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<std::shared_ptr<Node>> ready;
+    for (const auto& node : f->get_ordered_ops())
+    {
+        if (is_ready(node))
+            ready.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!ready.empty())
+    {
+        for (const auto& node : ready)
+        {
+            node->validate_and_infer_types();
+        }
+
+        // Threads take nodes one by one, so a large node does not hold back a whole chunk.
+        // A single ready node is folded on this thread and its kernel may run in parallel.
+        std::vector<OutputVector> replacements(ready.size());
+        std::vector<char> folded(ready.size(), 0);
+        std::atomic<size_t> next_node(0);
+        const size_t threads = std::min(runtime::reference::get_max_threads(), ready.size());
+        runtime::reference::parallel_for(threads, 1, [&](size_t, size_t) {
+            for (size_t i = next_node++; i < ready.size(); i = next_node++)
+            {
+                replacements[i].resize(ready[i]->get_output_size());
+                folded[i] = ready[i]->constant_fold(replacements[i], ready[i]->input_values());
+            }
+        });
+
+        // replacements are applied in the topological order, as the serial folding does
+        std::vector<std::shared_ptr<Node>> consumers;
+        for (size_t i = 0; i < ready.size(); ++i)
+        {
+            if (!folded[i])
+                continue;
+            for (const auto& output : ready[i]->outputs())
+            {
+                for (const auto& input : output.get_target_inputs())
+                    consumers.push_back(input.get_node()->shared_from_this());
+            }
+            rewritten |= replace_outputs(ready[i], replacements[i]);
+        }
+
+        ready.clear();
+        std::unordered_set<Node*> visited;
+        for (const auto& consumer : consumers)
+        {
+            if (visited.insert(consumer.get()).second && is_ready(consumer))
+                ready.push_back(consumer);
+        }
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     const std::shared_ptr<Node>& node, const Output<Node>& replacement)
 {
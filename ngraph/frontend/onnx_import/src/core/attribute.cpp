@@ -46,7 +46,8 @@ namespace ngraph
             // set opset version and domain from the parent graph
             *model_proto.mutable_opset_import() = parent_graph.get_opset_imports();
 
-            Model model{model_proto};
+            // the subgraph initializers are held by the proto of the parent graph
+            Model model{model_proto, parent_graph.get_tensors_owner()};
             return Subgraph{graph, model, parent_graph};
         }
 
@@ -100,7 +100,7 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_tensors_owner()};
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
@@ -326,6 +326,11 @@ namespace ngraph
             return m_model->get_opset_imports();
         }
 
+        const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& Graph::get_tensors_owner() const
+        {
+            return m_model->get_tensors_owner();
+        }
+
         Subgraph::Subgraph(const ONNX_NAMESPACE::GraphProto& proto,
                            Model& model,
                            const Graph& parent_graph)
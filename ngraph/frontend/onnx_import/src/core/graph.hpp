@@ -47,6 +47,7 @@ namespace ngraph
             OutputVector make_ng_nodes(const Node& onnx_node) const;
             const GraphCache& get_graph_cache() const;
             const OpsetImports& get_opset_imports() const;
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_tensors_owner() const;
 
         protected:
             Graph(const ONNX_NAMESPACE::GraphProto& proto,
@@ -43,8 +43,10 @@ namespace ngraph
             throw ngraph_error("Couldn't find operator set's version for domain: " + domain + ".");
         }
 
-        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto)
+        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                     std::shared_ptr<const ONNX_NAMESPACE::ModelProto> tensors_owner)
             : m_model_proto{&model_proto}
+            , m_tensors_owner{std::move(tensors_owner)}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -40,7 +41,14 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param model_proto    The ONNX model proto.
+            /// \param tensors_owner  The proto which holds the tensors of the model graph,
+            ///                       i.e. model_proto itself or, for subgraphs, the top-level
+            ///                       model proto. Constants created from the initializers alias
+            ///                       their raw data and keep tensors_owner alive. If it is null,
+            ///                       the data is copied.
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           std::shared_ptr<const ONNX_NAMESPACE::ModelProto> tensors_owner = {});
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -52,6 +60,10 @@ namespace ngraph
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const OpsetImports& get_opset_imports() const;
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_tensors_owner() const
+            {
+                return m_tensors_owner;
+            }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -84,6 +96,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_tensors_owner;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -483,8 +485,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor      The ONNX tensor proto.
+            /// \param data_owner  The proto which holds the tensor. If it is set, the nGraph
+            ///                    constant aliases the raw data of the tensor and keeps the owner
+            ///                    alive instead of copying the data.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> data_owner = {})
                 : m_tensor_proto{&tensor}
+                , m_data_owner{std::move(data_owner)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -606,8 +614,16 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (const auto shared_data = get_shared_data(type))
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, shared_data);
+                }
+                else
+                {
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -615,7 +631,43 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief Returns a buffer which aliases the tensor data without copying it: the raw
+            ///        data of the tensor if the proto owner is known, or the mapping of the
+            ///        external data file. Returns nullptr if the data has to be copied, i.e. it
+            ///        is stored in typed fields, is misaligned for the element type or its size
+            ///        does not match the shape.
+            std::shared_ptr<detail::SharedTensorData>
+                get_shared_data(const element::Type& type) const
+            {
+                const size_t byte_size = shape_size(m_shape) * type.size();
+                if (byte_size == 0 || m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+
+                std::shared_ptr<detail::SharedTensorData> shared_data;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    shared_data = detail::TensorExternalData(*m_tensor_proto).map_external_data();
+                }
+                else if (m_data_owner && m_tensor_proto->has_raw_data())
+                {
+                    std::shared_ptr<const void> owner = m_data_owner;
+                    const std::string& raw_data = m_tensor_proto->raw_data();
+                    shared_data = std::make_shared<detail::SharedTensorData>(
+                        const_cast<char*>(raw_data.data()), raw_data.size(), owner);
+                }
+
+                if (!shared_data || shared_data->size() != byte_size ||
+                    reinterpret_cast<std::uintptr_t>(shared_data->get_ptr()) % type.size() != 0)
+                {
+                    return nullptr;
+                }
+                return shared_data;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_data_owner;
             Shape m_shape;
         };
 
@@ -33,10 +33,11 @@ namespace ngraph
     {
         namespace detail
         {
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            std::shared_ptr<Function> convert_to_ng_function(
+                const ONNX_NAMESPACE::ModelProto& model_proto,
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> tensors_owner)
             {
-                Model model{model_proto};
+                Model model{model_proto, std::move(tensors_owner)};
                 Graph graph{model_proto.graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -48,23 +49,31 @@ namespace ngraph
                 return function;
             }
 
-            std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
-                                                        const std::string& model_path)
+            /// \param tensors_owner  The owner of model_proto, the constants alias raw data of its
+            ///                       initializers and keep it alive. If it is null, the
+            ///                       initializers are copied.
+            std::shared_ptr<Function>
+                import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
+                                  const std::string& model_path,
+                                  std::shared_ptr<const ONNX_NAMESPACE::ModelProto> tensors_owner)
             {
                 transform::expand_onnx_functions(model_proto);
                 transform::fixup_legacy_operators(model_proto);
                 transform::update_external_data_paths(model_proto, model_path);
 
-                return detail::convert_to_ng_function(model_proto);
+                return detail::convert_to_ng_function(model_proto, std::move(tensors_owner));
             }
         } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream,
                                                     const std::string& model_path)
         {
-            ONNX_NAMESPACE::ModelProto model_proto{parse_from_istream(stream)};
+            ONNX_NAMESPACE::ModelProto parsed_proto{parse_from_istream(stream)};
+            // the model proto is shared with the constants, which alias its initializers
+            const auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
+            model_proto->Swap(&parsed_proto);
 
-            return detail::import_onnx_model(model_proto, model_path);
+            return detail::import_onnx_model(*model_proto, model_path, model_proto);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -84,7 +93,9 @@ namespace ngraph
         {
             // this overload of the import_onnx_model is friended with the ONNXModelEditor
             // and thus can access its private members
-            return detail::import_onnx_model(model_editor.model(), model_editor.model_path());
+            // the editor keeps modifying its model, so the initializers are copied
+            return detail::import_onnx_model(
+                model_editor.model(), model_editor.model_path(), nullptr);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
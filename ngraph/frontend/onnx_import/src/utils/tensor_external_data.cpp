@@ -17,6 +17,18 @@
 #include <fstream>
 #include <sstream>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -28,6 +40,141 @@ namespace ngraph
     {
         namespace detail
         {
+            namespace
+            {
+                /// \brief Read-only mapping of a file range with copy-on-write pages
+                class MappedFileRange
+                {
+                public:
+                    MappedFileRange(const MappedFileRange&) = delete;
+                    MappedFileRange& operator=(const MappedFileRange&) = delete;
+
+                    /// \brief Maps size bytes at the offset of the file, the rest of the file if
+                    ///        size is 0. Returns nullptr on failure or if the range is empty or
+                    ///        does not fit into the file.
+                    static std::shared_ptr<MappedFileRange>
+                        map(const std::string& file_path, size_t offset, size_t size)
+                    {
+                        std::shared_ptr<MappedFileRange> range(new MappedFileRange());
+#ifdef _WIN32
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+                        std::wstring path =
+                            file_util::multi_byte_char_to_wstring(file_path.c_str());
+                        range->m_file = ::CreateFileW(path.c_str(),
+                                                      GENERIC_READ,
+                                                      FILE_SHARE_READ,
+                                                      nullptr,
+                                                      OPEN_EXISTING,
+                                                      FILE_ATTRIBUTE_NORMAL,
+                                                      nullptr);
+#else
+                        range->m_file = ::CreateFileA(file_path.c_str(),
+                                                      GENERIC_READ,
+                                                      FILE_SHARE_READ,
+                                                      nullptr,
+                                                      OPEN_EXISTING,
+                                                      FILE_ATTRIBUTE_NORMAL,
+                                                      nullptr);
+#endif
+                        if (range->m_file == INVALID_HANDLE_VALUE)
+                            return nullptr;
+
+                        LARGE_INTEGER file_size;
+                        if (!::GetFileSizeEx(range->m_file, &file_size) ||
+                            !range->set_size(static_cast<size_t>(file_size.QuadPart), offset, size))
+                            return nullptr;
+
+                        SYSTEM_INFO system_info;
+                        ::GetSystemInfo(&system_info);
+                        const size_t map_offset =
+                            offset - offset % system_info.dwAllocationGranularity;
+
+                        range->m_mapping = ::CreateFileMapping(
+                            range->m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                        if (range->m_mapping == nullptr)
+                            return nullptr;
+
+                        const auto offset64 = static_cast<unsigned long long>(map_offset);
+                        range->m_map_size = offset + range->m_size - map_offset;
+                        range->m_map = ::MapViewOfFile(range->m_mapping,
+                                                       FILE_MAP_COPY,
+                                                       static_cast<DWORD>(offset64 >> 32),
+                                                       static_cast<DWORD>(offset64),
+                                                       range->m_map_size);
+                        if (range->m_map == nullptr)
+                            return nullptr;
+#else
+                        const int fd = ::open(file_path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                            return nullptr;
+
+                        struct stat file_stat = {};
+                        if (::fstat(fd, &file_stat) != 0 ||
+                            !range->set_size(static_cast<size_t>(file_stat.st_size), offset, size))
+                        {
+                            ::close(fd);
+                            return nullptr;
+                        }
+
+                        const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGE_SIZE));
+                        const size_t map_offset = offset - offset % page_size;
+                        range->m_map_size = offset + range->m_size - map_offset;
+                        void* map = ::mmap(nullptr,
+                                           range->m_map_size,
+                                           PROT_READ | PROT_WRITE,
+                                           MAP_PRIVATE,
+                                           fd,
+                                           static_cast<off_t>(map_offset));
+                        // the mapping stays valid after the descriptor is closed
+                        ::close(fd);
+                        if (map == MAP_FAILED)
+                            return nullptr;
+                        range->m_map = map;
+#endif
+                        range->m_data = static_cast<char*>(range->m_map) + (offset - map_offset);
+                        return range;
+                    }
+
+                    ~MappedFileRange()
+                    {
+#ifdef _WIN32
+                        if (m_map != nullptr)
+                            ::UnmapViewOfFile(m_map);
+                        if (m_mapping != nullptr)
+                            ::CloseHandle(m_mapping);
+                        if (m_file != INVALID_HANDLE_VALUE)
+                            ::CloseHandle(m_file);
+#else
+                        if (m_map != nullptr)
+                            ::munmap(m_map, m_map_size);
+#endif
+                    }
+
+                    char* data() const { return m_data; }
+                    size_t size() const { return m_size; }
+
+                private:
+                    MappedFileRange() = default;
+
+                    bool set_size(size_t file_size, size_t offset, size_t size)
+                    {
+                        if (offset >= file_size || size > file_size - offset)
+                            return false;
+                        m_size = size == 0 ? file_size - offset : size;
+                        return true;
+                    }
+
+                    void* m_map = nullptr;
+                    size_t m_map_size = 0;
+                    char* m_data = nullptr;
+                    size_t m_size = 0;
+#ifdef _WIN32
+                    HANDLE m_file = INVALID_HANDLE_VALUE;
+                    HANDLE m_mapping = nullptr;
+#endif
+                };
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -35,9 +182,9 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
@@ -55,19 +202,16 @@ namespace ngraph
                 if (external_data_stream.fail())
                     throw error::invalid_external_data{*this};
 
+                const std::streamsize file_size = external_data_stream.tellg();
                 std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
+                if (m_data_lenght == 0) // read the rest of the file
+                    read_data_lenght = file_size - static_cast<std::streamsize>(m_offset);
                 else
                     read_data_lenght = m_data_lenght;
+                if (static_cast<std::streamsize>(m_offset) >= file_size || read_data_lenght < 0 ||
+                    read_data_lenght > file_size - static_cast<std::streamsize>(m_offset))
+                    throw error::invalid_external_data{*this};
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -79,11 +223,36 @@ namespace ngraph
                 std::string read_data;
                 read_data.resize(read_data_lenght);
                 external_data_stream.read(&read_data[0], read_data_lenght);
+                if (external_data_stream.gcount() != read_data_lenght)
+                    throw error::invalid_external_data{*this};
                 external_data_stream.close();
 
                 return read_data;
             }
 
+            std::shared_ptr<SharedTensorData> TensorExternalData::map_external_data() const
+            {
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                // unlike reading, mapping does not need the offset to be a multiple of the page
+                // size: the mapping starts at the page holding the offset
+                const auto range = MappedFileRange::map(m_data_location, m_offset, m_data_lenght);
+                if (!range)
+                {
+                    // e.g. the file system does not support mapping, or the address space is
+                    // exhausted: the data is read into memory owned by the buffer
+                    const auto data = std::make_shared<std::string>(load_external_data());
+                    std::shared_ptr<const void> owner = data;
+                    return std::make_shared<SharedTensorData>(
+                        const_cast<char*>(data->data()), data->size(), owner);
+                }
+                std::shared_ptr<const void> owner = range;
+                return std::make_shared<SharedTensorData>(range->data(), range->size(), owner);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
@@ -16,14 +16,21 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            /// \brief  Tensor data which lives in memory kept alive by the owner object, e.g. in
+            ///         the model proto or in a mapping of an external data file
+            using SharedTensorData = runtime::SharedBuffer<std::shared_ptr<const void>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -32,13 +39,23 @@ namespace ngraph
 
                 /// \brief      Load external data from tensor passed to constructor
                 ///
-                /// \note       If read data from external file fails,
                 /// \note       If reading data from external files fails,
                 ///             the invalid_external_data exception is thrown.
                 ///
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       Pages of the file are mapped copy-on-write and read on the first
+                ///             access. If the file cannot be mapped, the data is read into memory
+                ///             as load_external_data() does. If the file cannot be opened or the
+                ///             data range exceeds the file, the invalid_external_data exception
+                ///             is thrown.
+                ///
+                /// \return     Buffer aliasing the mapped or read data
+                std::shared_ptr<SharedTensorData> map_external_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -46,8 +63,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location;
-                int m_offset = 0;
-                int m_data_lenght = 0;
+                size_t m_offset = 0;
+                size_t m_data_lenght = 0;
                 int m_sha1_digest = 0;
             };
         }
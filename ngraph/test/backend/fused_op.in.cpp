@@ -1952,6 +1952,48 @@ NGRAPH_TEST(${BACKEND_NAME}, DISABLED_fake_quantize_pdpd)
     test_case.run();
 }
 
+// Ranges vary along non-leading axes of the data and are broadcast over the other ones
+NGRAPH_TEST(${BACKEND_NAME}, fake_quantize_ranges_broadcast_over_inner_axes)
+{
+    Shape data_shape{1, 2, 3, 4};
+    size_t levels = 5;
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto input_low = make_shared<op::Parameter>(element::f32, Shape{3, 1});
+    auto input_high = make_shared<op::Parameter>(element::f32, Shape{3, 1});
+    auto output_low = make_shared<op::Parameter>(element::f32, Shape{1, 1, 4});
+    auto output_high = make_shared<op::Parameter>(element::f32, Shape{1, 1, 4});
+
+    auto quantize =
+        make_shared<op::FakeQuantize>(data, input_low, input_high, output_low, output_high, levels);
+    auto function = make_shared<Function>(
+        NodeVector{quantize},
+        ParameterVector{data, input_low, input_high, output_low, output_high});
+    auto test_case = test::TestCase<TestEngine>(function);
+
+    size_t n_elements = shape_size(data_shape);
+    vector<float> input_data(n_elements);
+    iota(begin(input_data), end(input_data), 0);
+
+    test_case.add_input<float>(input_data);
+    // input_low
+    test_case.add_input<float>(vector<float>{1.f, 5.f, 13.f});
+    // input_high
+    test_case.add_input<float>(vector<float>{9.f, 21.f, 22.f});
+    // output_low
+    test_case.add_input<float>(vector<float>{0.f, -1.f, 2.f, 10.f});
+    // output_high
+    test_case.add_input<float>(vector<float>{4.f, 3.f, 6.f, 20.f});
+
+    // expected result
+    test_case.add_expected_output<float>(
+        data_shape,
+        vector<float>{0.0f, -1.0f, 2.0f, 12.5f, 0.0f, -1.0f, 2.0f, 10.0f,
+                      0.0f, -1.0f, 2.0f, 10.0f, 4.0f, 3.0f,  6.0f, 20.0f,
+                      3.0f, 2.0f,  5.0f, 20.0f, 3.0f, 3.0f,  6.0f, 20.0f});
+
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, rnn_cell__no_bias)
 {
     const size_t batch_size = 2;
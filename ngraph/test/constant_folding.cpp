@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -3168,3 +3170,137 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+static vector<float16> make_weights_values(size_t size, size_t layer)
+{
+    vector<float16> weights_values(size);
+    for (size_t i = 0; i < weights_values.size(); i++)
+    {
+        weights_values[i] = float16(static_cast<float>((i * 7 + layer) % 255) / 64.f - 2.f);
+    }
+    return weights_values;
+}
+
+static vector<float> make_scale_values(size_t oc)
+{
+    vector<float> scale_values(oc);
+    for (size_t i = 0; i < oc; i++)
+    {
+        scale_values[i] = 1.f + static_cast<float>(i % 5) / 4.f;
+    }
+    return scale_values;
+}
+
+// Weights preprocessing of convolutions as it comes in IRs: weights stored in f16 are converted,
+// scaled per output channel, transposed and reshaped. Channels are {output, input} per layer.
+static shared_ptr<Function>
+    make_weights_preprocessing(const vector<pair<size_t, size_t>>& channels, size_t kernel)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1});
+    ResultVector results;
+    for (size_t layer = 0; layer < channels.size(); layer++)
+    {
+        const size_t oc = channels[layer].first;
+        const size_t ic = channels[layer].second;
+        auto weights_values = make_weights_values(oc * ic * kernel * kernel, layer);
+        auto scale_values = make_scale_values(oc);
+
+        auto weights =
+            op::Constant::create(element::f16, Shape{oc, ic, kernel, kernel}, weights_values);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto scale = op::Constant::create(element::f32, Shape{oc, 1, 1, 1}, scale_values);
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        auto order = op::Constant::create(element::i64, Shape{4}, {1, 0, 2, 3});
+        auto transpose = make_shared<op::v1::Transpose>(multiply, order);
+        auto pattern =
+            op::Constant::create(element::i64, Shape{2}, {int64_t(ic), int64_t(-1)});
+        auto reshape = make_shared<op::v1::Reshape>(transpose, pattern, true);
+        reshape->set_friendly_name("weights_" + to_string(layer));
+        results.push_back(make_shared<op::Result>(reshape));
+    }
+    // a subgraph which depends on a parameter is left as is
+    auto add = make_shared<op::v1::Add>(data, op::Constant::create(element::f32, Shape{1}, {1}));
+    results.push_back(make_shared<op::Result>(add));
+    return make_shared<Function>(results, ParameterVector{data});
+}
+
+TEST(constant_folding, parallel_folding_matches_serial)
+{
+    const vector<pair<size_t, size_t>> channels{
+        {64, 3}, {64, 64}, {128, 64}, {256, 128}, {16, 256}};
+    auto serial = make_weights_preprocessing(channels, 3);
+    auto parallel = make_weights_preprocessing(channels, 3);
+
+    pass::ConstantFolding(false).run_on_function(serial);
+    pass::ConstantFolding(true).run_on_function(parallel);
+
+    // naive computation of the {ic, oc * kernel * kernel} weights of each layer
+    const size_t kernel_size = 3 * 3;
+    vector<vector<float>> expected;
+    for (size_t layer = 0; layer < channels.size(); layer++)
+    {
+        const size_t oc = channels[layer].first;
+        const size_t ic = channels[layer].second;
+        const auto weights_values = make_weights_values(oc * ic * kernel_size, layer);
+        const auto scale_values = make_scale_values(oc);
+        vector<float> values(oc * ic * kernel_size);
+        for (size_t o = 0; o < oc; o++)
+        {
+            for (size_t i = 0; i < ic; i++)
+            {
+                for (size_t k = 0; k < kernel_size; k++)
+                {
+                    values[(i * oc + o) * kernel_size + k] =
+                        static_cast<float>(weights_values[(o * ic + i) * kernel_size + k]) *
+                        scale_values[o];
+                }
+            }
+        }
+        expected.push_back(values);
+    }
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(parallel), 1);
+    for (size_t i = 0; i < channels.size(); i++)
+    {
+        auto serial_const = as_type_ptr<op::Constant>(
+            serial->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        auto parallel_const = as_type_ptr<op::Constant>(
+            parallel->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(serial_const);
+        ASSERT_TRUE(parallel_const);
+        ASSERT_EQ(parallel_const->get_friendly_name(), "weights_" + to_string(i));
+        ASSERT_EQ(serial_const->get_shape(),
+                  (Shape{channels[i].second, expected[i].size() / channels[i].second}));
+        ASSERT_EQ(parallel_const->get_shape(), serial_const->get_shape());
+        ASSERT_EQ(serial_const->cast_vector<float>(), expected[i]);
+        ASSERT_EQ(parallel_const->cast_vector<float>(), expected[i]);
+    }
+}
+
+// Load time of the weights preprocessing of ResNet-50 sized convolutions. Reference kernels
+// use NGRAPH_REFERENCE_THREADS threads, all hardware threads by default.
+TEST(constant_folding, DISABLED_parallel_folding_load_time)
+{
+    vector<pair<size_t, size_t>> channels;
+    for (auto stage : vector<pair<size_t, size_t>>{{64, 3}, {128, 4}, {256, 6}, {512, 3}})
+    {
+        for (size_t block = 0; block < stage.second; block++)
+        {
+            channels.emplace_back(stage.first, stage.first * 4);
+            channels.emplace_back(stage.first, stage.first);
+            channels.emplace_back(stage.first * 4, stage.first);
+        }
+    }
+
+    for (bool parallel : {false, true})
+    {
+        auto f = make_weights_preprocessing(channels, 3);
+        const auto start = chrono::steady_clock::now();
+        pass::ConstantFolding(parallel).run_on_function(f);
+        const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+        cout << (parallel ? "parallel" : "serial") << " constant folding: " << elapsed.count()
+             << " ms" << endl;
+    }
+}
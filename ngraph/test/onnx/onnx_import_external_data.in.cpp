@@ -14,6 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #include "default_opset.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -101,6 +109,43 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_in_page)
+{
+    // the data is mapped from the page holding the offset
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_offset_in_page.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // B: {2.f, 3.f} read from the external file at offset 4
+    test_case.add_input<float>({1.f, 1.f});
+
+    test_case.add_expected_output<float>(Shape{2}, {3.f, 4.f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_outlives_model_file)
+{
+    const auto path =
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt");
+    std::shared_ptr<Function> function;
+    {
+        std::ifstream stream{path, std::ios::in | std::ios::binary};
+        ASSERT_TRUE(stream.is_open());
+        function = onnx_import::import_onnx_model(stream, path);
+    }
+
+    std::shared_ptr<default_opset::Constant> initializer;
+    for (const auto& op : function->get_ops())
+    {
+        if (op->get_friendly_name() == "A")
+        {
+            initializer = as_type_ptr<default_opset::Constant>(op);
+        }
+    }
+    ASSERT_TRUE(initializer);
+    EXPECT_EQ(initializer->cast_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -122,6 +167,26 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_range_exceeds_file_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_range_exceeds_file.prototxt"));
+        FAIL() << "Data range exceeding the external data file not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 12, data_lenght: 8, sha1_digest: 0)"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_up_dir_path)
 {
     try
@@ -155,3 +220,60 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path)
 
     test_case.run();
 }
+
+// Import time and peak RSS growth for a model with 256 MB of external weights. The weights are
+// mapped rather than read, so the RSS grows only by the pages touched during the import.
+NGRAPH_TEST(${BACKEND_NAME}, DISABLED_onnx_external_data_import_time_and_peak_rss)
+{
+    const size_t weights_count = 64 * 1024 * 1024;
+    const std::string data_path = "external_data_benchmark.data";
+    const std::string model_path = "external_data_benchmark.prototxt";
+    {
+        std::vector<float> weights(1024 * 1024, 1.f);
+        std::ofstream data{data_path, std::ios::out | std::ios::binary};
+        for (size_t i = 0; i < weights_count / weights.size(); i++)
+        {
+            data.write(reinterpret_cast<const char*>(weights.data()),
+                       weights.size() * sizeof(float));
+        }
+        std::ofstream model{model_path};
+        model << "ir_version: 3\n"
+              << "producer_name: \"nGraph ONNX Importer\"\n"
+              << "graph {\n"
+              << "  node { input: \"A\" input: \"B\" output: \"Y\" op_type: \"Add\" }\n"
+              << "  name: \"benchmark_graph\"\n"
+              << "  initializer {\n"
+              << "    dims: " << weights_count << " data_type: 1 name: \"B\"\n"
+              << "    external_data { key: \"location\" value: \"" << data_path << "\" }\n"
+              << "    data_location: 1\n"
+              << "  }\n"
+              << "  input { name: \"A\" type { tensor_type { elem_type: 1 shape {\n"
+              << "    dim { dim_value: " << weights_count << " } } } } }\n"
+              << "  output { name: \"Y\" type { tensor_type { elem_type: 1 shape {\n"
+              << "    dim { dim_value: " << weights_count << " } } } } }\n"
+              << "}\n"
+              << "opset_import { version: 4 }\n";
+    }
+
+#ifndef _WIN32
+    rusage usage_before{};
+    getrusage(RUSAGE_SELF, &usage_before);
+#endif
+    const auto start = std::chrono::steady_clock::now();
+    auto function = onnx_import::import_onnx_model(model_path);
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::cout << "import time: " << elapsed.count() << " ms" << std::endl;
+#ifndef _WIN32
+    rusage usage_after{};
+    getrusage(RUSAGE_SELF, &usage_after);
+    // ru_maxrss is in kilobytes on Linux
+    std::cout << "peak RSS growth: " << (usage_after.ru_maxrss - usage_before.ru_maxrss) / 1024
+              << " MB" << std::endl;
+#endif
+    EXPECT_EQ(function->get_ops().size(), 4);
+
+    function.reset();
+    std::remove(model_path.c_str());
+    std::remove(data_path.c_str());
+}